@@ -9,17 +9,105 @@
 
 #include "yallic.h"
 
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 /**
- * A simple, internally-used macro to allocate a new linked list node item.
+ * Set when the vectorized pointer search kernels can be built, which only needs GCC or
+ *   Clang on x86-64: the kernels are compiled for their own instruction sets and picked
+ *   at runtime, so the library's build flags don't change.
+ */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define LIST_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * A simple, internally-used macro to allocate a new linked list node item from the
+ *   node pool owned by the given list.
+ *
+ * @see ListNode_t*
+ */
+#define LIST_NODE_INITIALIZER(p_list) __List__node_alloc( p_list )
+
+/**
+ * A simple, internally-used macro to hand a linked list node item back to the node
+ *   pool owned by the given list.
  *
  * @see ListNode_t*
  */
-#define LIST_NODE_INITIALIZER (ListNode_t*)calloc( 1, sizeof(ListNode_t) )
+#define LIST_NODE_RELEASE(p_list, p_node) __List__node_free( p_list, p_node )
+
+/**
+ * Internally-used mask of the flags which turn a list into a concurrent container.
+ */
+#define LIST_CONCURRENT_MODES (LIST_CONCURRENT_STACK | LIST_CONCURRENT_QUEUE | LIST_SPSC_RING)
+
+/**
+ * Internally-used mask of the flags which give a list its own kind of storage. These
+ *   can't be combined with any other flag.
+ */
+#define LIST_EXCLUSIVE_MODES (LIST_CONCURRENT_MODES | LIST_UNROLLED)
+
+/**
+ * Internally-used macro which makes a public function bail out with the given value when
+ *   it is called on a list in a concurrent mode; those lists only support the operations
+ *   which their mode implements.
+ *
+ * @see ListConcurrent_t
+ */
+#define LIST_REFUSE_CONCURRENT(p_list, retval) \
+    do { if (  NULL != (p_list) && ((p_list)->flags & LIST_CONCURRENT_MODES)  )  return retval; } while ( 0 )
+
+/**
+ * Internally-used macro which makes a public function take a private copy of a list's
+ *   shared nodes before changing them, bailing out with the given value if it can't.
+ *
+ * @see ListShare_t
+ */
+#define LIST_UNSHARE(p_list, retval) \
+    do { if (  NULL != (p_list) && NULL != (p_list)->p_share && !__List__unshare( p_list )  )  return retval; } while ( 0 )
+
+/**
+ * Internally-used macro to allocate a block of memory through a list's allocator.
+ *   The returned memory is _not_ zeroed.
+ *
+ * @see ListAllocator_t
+ */
+#define LIST_ALLOC(p_list, size) (*((p_list)->allocator.alloc))( (size), (p_list)->allocator.p_context )
+
+/**
+ * Internally-used macro to release a block of memory through a list's allocator.
+ *
+ * @see ListAllocator_t
+ */
+#define LIST_FREE(p_list, ptr) (*((p_list)->allocator.free))( (ptr), (p_list)->allocator.p_context )
 
 static const unsigned long long __list_size_max_limit = 0xFFFFFFFFFFFFFFFF;   /**< Linked list maximum allowable count. */
+static const size_t __list_pool_chunk_min_nodes = 32;   /**< Node capacity of the first chunk in a node pool. */
+static const size_t __list_pool_chunk_max_nodes = 4096;   /**< Node capacity at which node pool chunks stop growing. */
+static const size_t __list_index_unknown = (size_t)-1;   /**< Position hint given when a node's index is not known. */
+static const size_t __list_finger_reach = 32;   /**< Farthest an indexed list walks from its finger rather than seeking through its skip index. */
+static const unsigned long long __list_skip_seed = 0x9E3779B97F4A7C15ULL;   /**< Initial state of each skip index's tower height generator. */
+static const unsigned long long __list_hash_multiplier = 0x9E3779B97F4A7C15ULL;   /**< Fibonacci hashing multiplier for pointer keys. */
+static const size_t __list_hash_min_slots = 16;   /**< Slot count of a pointer hash when it is first allocated. */
+static const size_t __list_sort_parallel_min_run = 16384;   /**< Fewest nodes worth handing to a sorting thread. */
+static const size_t __list_for_each_chunks_per_thread = 4;   /**< Chunks made per pool thread, to balance uneven actions. */
+static const unsigned int __list_tag_shift = (UINTPTR_MAX > 0xFFFFFFFFu) ? 48 : 32;   /**< Bit position of the generation tag in a tagged pointer. */
+
+/**
+ * The assumed size of a CPU cache line, used to keep contended atomics apart.
+ */
+#define LIST_CACHE_LINE 64
+
+/**
+ * The maximum amount of express lanes a skip index can use. Towers grow with a 1/4
+ *   probability per level, so this is far more than any list can fill.
+ */
+#define LIST_SKIP_MAX_LEVELS 32
 
 
 
@@ -47,887 +135,5137 @@ struct __linked_list_node_t {
  */
 typedef struct __linked_list_node_t ListNode_t;
 
-/**
- * The primary, generic linked-list structure.
- *   The LIST maintains a max_count with a HEAD pointer.
- *
- * @typedef List_t
- * @struct List_t
- */
-struct __linked_list_t {
-    ListNode_t* head;   /**< The list's HEAD pointer. */
-    size_t max_size;   /**< The list's maximum size, defined on instantiation. */
-};
+/**
+ * The node layout used by doubly-linked lists. The regular node is embedded first, so a
+ *   pointer to one of these is also a valid ListNode_t pointer; only lists created with
+ *   the LIST_DOUBLY_LINKED flag allocate nodes with the extra back-pointer.
+ *
+ * @typedef ListDoubleNode_t
+ * @struct ListDoubleNode_t
+ */
+typedef struct __linked_list_double_node_t {
+    ListNode_t node;   /**< The regular list node. */
+    ListNode_t* prev;   /**< Pointer to the previous linked list node. */
+} ListDoubleNode_t;
+
+/**
+ * Internally-used macro to access the back-pointer of a node from a doubly-linked list.
+ *
+ * @see ListDoubleNode_t
+ */
+#define LIST_NODE_PREV(p_node) (((ListDoubleNode_t*)(p_node))->prev)
+
+/**
+ * A single contiguous slab of list nodes. Nodes are handed out from the slab in order
+ *   by bumping the 'used' counter; the node storage itself immediately follows this
+ *   header in memory.
+ *
+ * @typedef ListNodeChunk_t
+ * @struct ListNodeChunk_t
+ */
+typedef struct __linked_list_node_chunk_t {
+    struct __linked_list_node_chunk_t* next;   /**< The next chunk in the pool's chain. */
+    size_t capacity;   /**< The amount of nodes this chunk can hold. */
+    size_t used;   /**< The amount of nodes carved out of this chunk so far. */
+} ListNodeChunk_t;
+
+/**
+ * A per-list slab allocator for list nodes. Nodes are carved out of large chunks, and
+ *   released nodes are threaded onto an intrusive free list (through their 'next'
+ *   pointers) to be handed out again before any new chunk space is used.
+ *
+ * @typedef ListNodePool_t
+ * @struct ListNodePool_t
+ */
+typedef struct __linked_list_node_pool_t {
+    ListNodeChunk_t* chunks;   /**< The first chunk in the pool, in allocation order. */
+    ListNodeChunk_t* current;   /**< The chunk nodes are being carved from. Chunks after it are unused. */
+    ListNode_t* free_nodes;   /**< Intrusive list of released nodes awaiting reuse. */
+    size_t capacity;   /**< The total amount of nodes held across all chunks. */
+    size_t node_size;   /**< The size of each node in the pool, which depends on the list's flags. */
+} ListNodePool_t;
+
+/**
+ * One express link of a skip index: the next node which also reaches this level, and
+ *   how many positions forward that node lies.
+ *
+ * @typedef ListSkipLane_t
+ * @struct ListSkipLane_t
+ */
+typedef struct __linked_list_skip_lane_t {
+    ListNode_t* next;   /**< The next node with a tower at least this tall. NULL past the last one. */
+    size_t span;   /**< The distance in positions to 'next'. Meaningless when 'next' is NULL. */
+} ListSkipLane_t;
+
+/**
+ * The express links held by a single node of an indexed list. Only nodes which were
+ *   promoted to at least one express lane have a tower; the rest keep a NULL pointer.
+ *
+ * @typedef ListSkipTower_t
+ * @struct ListSkipTower_t
+ */
+typedef struct __linked_list_skip_tower_t {
+    size_t height;   /**< The amount of lanes in the tower. */
+    ListSkipLane_t lanes[];   /**< The express links, from the lowest lane upward. */
+} ListSkipTower_t;
+
+/**
+ * A positional skip index over the node chain of a LIST_INDEXED list. The node chain
+ *   itself serves as the bottom level, and the express lanes start from a virtual
+ *   header which sits just before the HEAD.
+ *
+ * @typedef ListSkipIndex_t
+ * @struct ListSkipIndex_t
+ */
+typedef struct __linked_list_skip_index_t {
+    size_t levels;   /**< The amount of express lanes currently in use. */
+    bool dirty;   /**< Set when the lanes no longer match the chain and must be rebuilt. */
+    unsigned long long seed;   /**< The state of the tower height generator. */
+    ListSkipLane_t head[LIST_SKIP_MAX_LEVELS];   /**< The header's lanes. */
+} ListSkipIndex_t;
+
+/**
+ * A single slot of a pointer hash. Each distinct data pointer in the list owns one slot,
+ *   which counts its occurrences and remembers its first occurrence when that is known.
+ *
+ * @typedef ListHashEntry_t
+ * @struct ListHashEntry_t
+ */
+typedef struct __linked_list_hash_entry_t {
+    void* key;   /**< The data pointer. NULL marks an empty slot. */
+    ListNode_t* node;   /**< The first node holding the pointer, or NULL if it must be looked up again. */
+    size_t count;   /**< The amount of nodes holding the pointer. */
+} ListHashEntry_t;
+
+/**
+ * An open-addressing (linear probing) hash from data pointers to nodes, kept by lists
+ *   created with the LIST_HASHED flag.
+ *
+ * @typedef ListHashIndex_t
+ * @struct ListHashIndex_t
+ */
+typedef struct __linked_list_hash_index_t {
+    ListHashEntry_t* slots;   /**< The slot table. NULL until the first pointer is indexed. */
+    size_t capacity;   /**< The amount of slots, always a power of two. */
+    size_t used;   /**< The amount of occupied slots. */
+    unsigned int shift;   /**< The right-shift which turns a 64-bit hash into a slot number. */
+    bool dirty;   /**< Set when the table no longer matches the chain and must be rebuilt. */
+} ListHashIndex_t;
+
+/**
+ * A unit of work for a thread of a parallel sort: either sorting one run, or merging one
+ *   run with the run following it.
+ *
+ * @typedef ListSortJob_t
+ * @struct ListSortJob_t
+ */
+typedef struct __linked_list_sort_job_t {
+    ListNode_t* p_head;   /**< The run, which is replaced by the sorted or merged run. */
+    ListNode_t* p_tail;   /**< The last node of the resulting run. */
+    ListNode_t* p_right;   /**< The following run to merge in. Unused when sorting. */
+    int (*cmp)(const void*, const void*);   /**< The comparator. */
+} ListSortJob_t;
+
+/**
+ * The shared state of a LIST_CONCURRENT_STACK or LIST_CONCURRENT_QUEUE list. Its nodes are
+ *   reached through tagged words holding a node pointer in the low bits and a generation
+ *   tag, bumped on every successful swap, in the high bits. Each contended word sits on its
+ *   own cache line.
+ *
+ * @typedef ListConcurrent_t
+ * @struct ListConcurrent_t
+ */
+typedef struct __linked_list_concurrent_t {
+    _Atomic uint64_t top;   /**< The tagged top of a stack, or the tagged dummy node at the head of a queue. */
+    char pad_top[LIST_CACHE_LINE - sizeof(uint64_t)];
+    _Atomic uint64_t tail;   /**< The tagged last node of a queue, which may lag one node behind. Unused by stacks. */
+    char pad_tail[LIST_CACHE_LINE - sizeof(uint64_t)];
+    _Atomic uint64_t free_top;   /**< The tagged top of the stack of recycled nodes. */
+    char pad_free[LIST_CACHE_LINE - sizeof(uint64_t)];
+    _Atomic size_t count;   /**< The amount of elements, including pushes which are in flight. */
+    _Atomic size_t max_size;   /**< The list's maximum size. */
+    char pad_count[LIST_CACHE_LINE - (2 * sizeof(size_t))];
+    pthread_mutex_t grow_lock;   /**< Serializes node allocations from the (single-threaded) node pool. */
+} ListConcurrent_t;
+
+/**
+ * Internally-used macro to access the 'next' pointer of a node atomically. Nodes of a
+ *   concurrent stack can be read by a thread which lost a race for them while another
+ *   thread relinks them, so every access to their links goes through this.
+ */
+#define LIST_NODE_NEXT_ATOMIC(p_node) ((_Atomic(ListNode_t*)*)&((p_node)->next))
+
+/**
+ * A node of a LIST_CONCURRENT_QUEUE list. Unlike stacks, queues compare-and-swap the link
+ *   of a node which another thread may recycle meanwhile, so the link carries a tag too.
+ *
+ * @typedef ListQueueNode_t
+ * @struct ListQueueNode_t
+ */
+typedef struct __linked_list_queue_node_t {
+    _Atomic uint64_t next;   /**< The tagged next node in the queue, or in the free list. */
+    _Atomic(void*) data;   /**< Data pointer, read by dequeuers racing for the node. */
+} ListQueueNode_t;
+
+/**
+ * The number of data pointers held by each node of a LIST_UNROLLED list, which fills
+ *   the node out to two cache lines.
+ */
+#define LIST_UNROLLED_SLOTS (((2 * LIST_CACHE_LINE) - (3 * sizeof(void*))) / sizeof(void*))
+
+/**
+ * A node of a LIST_UNROLLED list, holding a run of consecutive elements. An unrolled
+ *   list's HEAD and TAIL point at these instead of regular nodes. Every node holds at
+ *   least one element.
+ *
+ * @typedef ListUnrolledNode_t
+ * @struct ListUnrolledNode_t
+ */
+typedef struct __linked_list_unrolled_node_t {
+    struct __linked_list_unrolled_node_t* next;   /**< The next node in the chain. */
+    struct __linked_list_unrolled_node_t* prev;   /**< The previous node in the chain. */
+    size_t used;   /**< The amount of filled slots, which are always the first ones. */
+    void* data[LIST_UNROLLED_SLOTS];   /**< The data pointers of the node's elements, in order. */
+} ListUnrolledNode_t;
+
+/**
+ * Internally-used macros to get the HEAD and TAIL of a LIST_UNROLLED list.
+ *
+ * @see ListUnrolledNode_t
+ */
+#define LIST_UNROLLED_HEAD(p_list) ((ListUnrolledNode_t*)(p_list)->head)
+#define LIST_UNROLLED_TAIL(p_list) ((ListUnrolledNode_t*)(p_list)->tail)
+
+/**
+ * A kernel searching an array of data pointers for the first (or last) slot holding the
+ *   given pointer. Returns the slot's index, or the array's length if there is none.
+ *
+ * @typedef ListPtrFind_t
+ */
+typedef size_t (*ListPtrFind_t)( void* const* pp_data, size_t count, void* p_data, bool last );
+
+/**
+ * The slots of a LIST_SPSC_RING list. Both indices run freely and are masked to find their
+ *   slot; the element count is their difference. Each side also keeps a private copy of the
+ *   other side's index, only refreshed once the copy says the ring is full (or empty), so
+ *   most operations never touch the other thread's cache line.
+ *
+ * @typedef ListRing_t
+ * @struct ListRing_t
+ */
+typedef struct __linked_list_ring_t {
+    _Atomic size_t head;   /**< Index of the next slot to consume. Written by the consumer only. */
+    size_t cached_tail;   /**< The consumer's last view of the tail index. */
+    char pad_head[LIST_CACHE_LINE - (2 * sizeof(size_t))];
+    _Atomic size_t tail;   /**< Index of the next slot to fill. Written by the producer only. */
+    size_t cached_head;   /**< The producer's last view of the head index. */
+    char pad_tail[LIST_CACHE_LINE - (2 * sizeof(size_t))];
+    _Atomic size_t max_size;   /**< The list's maximum size, never more than the slot count. */
+    size_t mask;   /**< The slot count (a power of two) minus one. */
+    void** slots;   /**< The data pointers. */
+} ListRing_t;
+
+/**
+ * A node chain shared by copy-on-write lists. The nodes stay in the pool of the list
+ *   they were first shared from, which the share takes over; no list may change a
+ *   shared node, and the last list to let go of the share releases the pool.
+ *
+ * @typedef ListShare_t
+ * @struct ListShare_t
+ */
+typedef struct __linked_list_share_t {
+    _Atomic size_t refs;   /**< The amount of lists reading from the shared chain. */
+    ListNodePool_t pool;   /**< The node pool holding the shared chain. */
+    ListNode_t* head;   /**< The first node of the chain when it was first shared. */
+    size_t count;   /**< The length of the chain when it was first shared. */
+} ListShare_t;
+
+/**
+ * A reusable set of worker threads. Jobs are handed over as an array of equally-sized task
+ *   structures and a function to run on each; threads claim tasks by index until none are
+ *   left. Each new job bumps the generation counter to wake the sleeping workers.
+ *
+ * @see ListThreadPool_t
+ */
+struct __linked_list_thread_pool_t {
+    pthread_mutex_t run_lock;   /**< Held for the duration of a job, so only one runs at a time. */
+    pthread_mutex_t lock;   /**< Guards every field below. */
+    pthread_cond_t work_ready;   /**< Signaled when a new job is posted, or at shutdown. */
+    pthread_cond_t work_done;   /**< Signaled when the last task of a job finishes. */
+    pthread_t* p_threads;   /**< The worker threads. */
+    size_t nthreads;   /**< The amount of worker threads. */
+    void (*run)(void*);   /**< The function run on each task of the current job. */
+    char* p_tasks;   /**< The task array of the current job. */
+    size_t task_size;   /**< The size of each task structure. */
+    size_t task_count;   /**< The amount of tasks in the current job. */
+    size_t next_task;   /**< The index of the next unclaimed task. */
+    size_t pending;   /**< The amount of tasks which are not finished yet. */
+    unsigned long generation;   /**< Bumped for every job posted to the pool. */
+    bool shutdown;   /**< Set when the workers must exit. */
+};
+
+/**
+ * A single chunk of a parallel for-each: a contiguous run of nodes and its private result.
+ *
+ * @typedef ListForEachTask_t
+ * @struct ListForEachTask_t
+ */
+typedef struct __linked_list_for_each_task_t {
+    ListNode_t* p_first;   /**< The first node of the chunk. */
+    ListUnrolledNode_t* p_unrolled;   /**< The first node of the chunk in an unrolled list, or NULL. */
+    size_t slot;   /**< The chunk's first slot within its unrolled node. */
+    size_t length;   /**< The amount of nodes in the chunk. */
+    void* p_result;   /**< The chunk's private result. */
+    void* p_input;   /**< The shared input data. */
+    void (*action)(void*, void*, void**);   /**< The per-element operation. */
+} ListForEachTask_t;
+
+/**
+ * Internally-used macro to access the tower pointer of a node from an indexed list. It
+ *   always occupies the final slot of the node, after any doubly-linked back-pointer.
+ *
+ * @see ListSkipTower_t
+ */
+#define LIST_NODE_TOWER(p_list, p_node) \
+    (*(ListSkipTower_t**)( (char*)(p_node) + (p_list)->pool.node_size - sizeof(ListSkipTower_t*) ))
+
+/**
+ * Internally-used macro to access a lane of a node, where a NULL node is the header.
+ *
+ * @see ListSkipIndex_t
+ */
+#define LIST_SKIP_LANE(p_list, p_node, level) \
+    ( (NULL == (p_node)) \
+        ? &((p_list)->p_index->head[level]) \
+        : &(LIST_NODE_TOWER( p_list, p_node )->lanes[level]) )
+
+/**
+ * The primary, generic linked-list structure.
+ *   The LIST maintains a max_count with HEAD and TAIL pointers, as well as a running
+ *   count of its nodes. Every mutator keeps the count and tail current, so length
+ *   queries, bounds checks, and tail access never need to walk the node chain.
+ *
+ * @typedef List_t
+ * @struct List_t
+ */
+struct __linked_list_t {
+    ListNode_t* head;   /**< The list's HEAD pointer. */
+    ListNode_t* tail;   /**< The list's TAIL pointer. NULL when the list is empty. */
+    size_t count;   /**< The amount of nodes currently linked into the list. */
+    size_t max_size;   /**< The list's maximum size, defined on instantiation. */
+    unsigned int flags;   /**< The ListFlags_t options the list was created with. */
+    ListNodePool_t pool;   /**< The slab allocator which owns all of the list's nodes. */
+    ListAllocator_t allocator;   /**< The memory callbacks used for every allocation the list makes. */
+    ListSkipIndex_t* p_index;   /**< The positional skip index of LIST_INDEXED lists. NULL otherwise. */
+    ListHashIndex_t* p_hash;   /**< The pointer hash of LIST_HASHED lists. NULL otherwise. */
+    ListConcurrent_t* p_concurrent;   /**< The shared state of concurrent stacks and queues. NULL otherwise. */
+    ListRing_t* p_ring;   /**< The slots of LIST_SPSC_RING lists. NULL otherwise. */
+    char* p_block;   /**< The element storage owned by lists from List__from_array_contiguous. NULL otherwise. */
+    size_t block_size;   /**< The size of the owned element storage, in bytes. */
+    ListShare_t* p_share;   /**< The node chain shared by LIST_COPY_ON_WRITE lists. NULL while the list owns its nodes. */
+    ListNode_t* p_finger;   /**< The node most recently found by its index, where nearby lookups start. NULL when unknown. */
+    size_t finger_index;   /**< The index of the finger node. */
+};
+
+
+
+// Internal function prototypes as needed.
+static void* __List__libc_alloc( size_t size, void* p_context );
+static void __List__libc_free( void* p_ptr, void* p_context );
+static ListNode_t* __List__node_alloc( List_t* p_list );
+static void __List__node_free( List_t* p_list, ListNode_t* p_node );
+static void __List__pool_reset( List_t* p_list );
+static void __List__pool_release( List_t* p_list );
+static int __List__chunk_compare( const void* p_a, const void* p_b );
+static ListNodeChunk_t* __List__chunk_owner( ListNodeChunk_t** pp_sorted, size_t chunk_count, const void* p_node );
+static void __List__link_node_after( List_t* p_list, ListNode_t* p_prev, ListNode_t* p_node, size_t index );
+static ListNode_t* __List__unlink_node_after( List_t* p_list, ListNode_t* p_prev, size_t index );
+static bool __List__pool_reserve( List_t* p_list, size_t count );
+static void __List__pool_adopt( List_t* p_list_dest, List_t* p_list_src );
+static List_t* __List__share_chain( List_t* p_list, ListNode_t* p_first, ListNode_t* p_last, size_t count );
+static void __List__share_release( List_t* p_list );
+static bool __List__unshare( List_t* p_list );
+static bool __List__cursor_unshare( ListCursor_t* p_cursor );
+static void* __List__chain_to_array(
+    List_t* p_list, ListNode_t* p_node, size_t count, size_t element_size, size_t extra_bytes );
+static void __List__chain_for_each(
+    ListNode_t* p_node, size_t count, void** pp_result, void* p_input, void (*action)(void*, void*, void**) );
+static bool __List__can_move_nodes( List_t* p_list_dest, List_t* p_list_src );
+static int __List__move_nodes( List_t* p_list_dest, List_t* p_list_src, size_t index );
+static ListNode_t* __List__chain_build(
+    List_t* p_list, void** pp_data, ListNode_t* p_src, size_t count, bool reversed, ListNode_t** pp_last );
+static void __List__chain_link_after(
+    List_t* p_list, ListNode_t* p_prev, size_t index, ListNode_t* p_first, ListNode_t* p_last, size_t count );
+static void __List__invalidate_positions( List_t* p_list );
+static void** __List__gather( List_t* p_list, size_t from_index, size_t count );
+static int __List__insert_list_at(
+    List_t* p_list_dest, size_t index, List_t* p_list_src, size_t from_index, size_t count );
+static ListNode_t* __List__merge_runs(
+    ListNode_t* p_left, ListNode_t* p_right, int (*cmp)(const void*, const void*), ListNode_t** pp_link );
+static ListNode_t* __List__sort_chain(
+    ListNode_t* p_head, int (*cmp)(const void*, const void*), ListNode_t** pp_tail );
+static void __List__sort_finish( List_t* p_list, ListNode_t* p_head, ListNode_t* p_tail );
+static void* __List__sort_worker( void* p_job );
+static void* __List__merge_worker( void* p_job );
+static void* __List__thread_pool_worker( void* p_arg );
+static void __List__thread_pool_drain( ListThreadPool_t* p_pool );
+static void __List__thread_pool_run(
+    ListThreadPool_t* p_pool, void (*run)(void*), void* p_tasks, size_t task_size, size_t task_count );
+static void __List__for_each_task( void* p_task );
+static void* __List__tagged_ptr( uint64_t word );
+static uint64_t __List__tagged_swap( uint64_t word, void* p_ptr );
+static void __List__stack_push_node( _Atomic uint64_t* p_top, ListNode_t* p_node );
+static ListNode_t* __List__stack_pop_node( _Atomic uint64_t* p_top );
+static size_t __List__concurrent_reserve( ListConcurrent_t* p_concurrent );
+static int __List__stack_push( List_t* p_list, void* p_data );
+static void* __List__stack_pop( List_t* p_list );
+static ListQueueNode_t* __List__queue_node_alloc( List_t* p_list );
+static void __List__queue_node_free( List_t* p_list, ListQueueNode_t* p_node );
+static int __List__queue_enqueue( List_t* p_list, void* p_data );
+static void* __List__queue_dequeue( List_t* p_list );
+static bool __List__concurrent_reset( List_t* p_list );
+static int __List__ring_add_many( List_t* p_list, void** pp_data, size_t count );
+static size_t __List__ring_pop_many( List_t* p_list, void** pp_data, size_t count );
+static ListUnrolledNode_t* __List__unrolled_node_new( List_t* p_list );
+static ListUnrolledNode_t* __List__unrolled_seek( List_t* p_list, size_t index, size_t* p_slot );
+static int __List__unrolled_insert( List_t* p_list, void* p_data, size_t index );
+static int __List__unrolled_insert_many( List_t* p_list, void** pp_data, size_t count, bool at_head );
+static int __List__unrolled_insert_run( List_t* p_list, size_t index, void** pp_data, size_t count );
+static void __List__unrolled_unlink( List_t* p_list, ListUnrolledNode_t* p_node );
+static void __List__unrolled_merge_next( List_t* p_list, ListUnrolledNode_t* p_node );
+static void* __List__unrolled_remove( List_t* p_list, size_t index );
+static void __List__unrolled_remove_run( List_t* p_list, size_t index, size_t count );
+static bool __List__unrolled_find( List_t* p_list, void* p_data, bool last, size_t* p_index );
+static void __List__unrolled_reverse( List_t* p_list );
+static void __List__unrolled_reverse_range( List_t* p_list, size_t from_index, size_t to_index );
+static int __List__unrolled_sort( List_t* p_list, int (*cmp)(const void*, const void*) );
+static int __List__unrolled_compact( List_t* p_list );
+static void __List__unrolled_for_each(
+    ListUnrolledNode_t* p_node, size_t slot, size_t count, void** pp_result, void* p_input, void (*action)(void*, void*, void**) );
+static void* __List__unrolled_to_array(
+    List_t* p_list, size_t from_index, size_t count, size_t element_size, size_t extra_bytes );
+static void __List__unrolled_cursor_seek( ListCursor_t* p_cursor );
+static List_t* __List__unrolled_clone( List_t* p_list );
+static size_t __List__ptr_find_scalar( void* const* pp_data, size_t count, void* p_data, bool last );
+#ifdef LIST_SIMD_X86
+static size_t __List__ptr_find_sse2( void* const* pp_data, size_t count, void* p_data, bool last );
+static size_t __List__ptr_find_avx2( void* const* pp_data, size_t count, void* p_data, bool last );
+#endif
+static ListPtrFind_t __List__ptr_find_kernel( void );
+static ListNode_t* __List__get_node_at( List_t* p_list, size_t index );
+static ListNode_t* __List__seek_node( List_t* p_list, size_t index );
+static size_t __List__skip_random_height( List_t* p_list );
+static ListSkipTower_t* __List__skip_tower_alloc( List_t* p_list, size_t height );
+static void __List__skip_find_path( List_t* p_list, size_t rank, ListNode_t** pp_update, size_t* p_ranks );
+static void __List__skip_insert( List_t* p_list, ListNode_t* p_node, size_t index );
+static void __List__skip_remove( List_t* p_list, ListNode_t* p_node, size_t index );
+static void __List__skip_drop_towers( List_t* p_list );
+static bool __List__skip_rebuild( List_t* p_list );
+static size_t __List__hash_slot( const ListHashIndex_t* p_hash, void* p_key );
+static ListHashEntry_t* __List__hash_find( List_t* p_list, void* p_key );
+static bool __List__hash_grow( List_t* p_list );
+static void __List__hash_add( List_t* p_list, ListNode_t* p_node );
+static void __List__hash_remove( List_t* p_list, ListNode_t* p_node );
+static void __List__hash_reset( List_t* p_list );
+static bool __List__hash_rebuild( List_t* p_list );
+static ListNode_t* __List__get_node_first_occurrence(
+    List_t* p_list, void* p_data, ListNode_t** pp_prev, size_t* p_index );
+static ListNode_t* __List__get_node_last_occurrence(
+    List_t* p_list, void* p_data, ListNode_t** pp_prev, size_t* p_index );
+
+
+
+/**
+ * The default set of allocator callbacks, which simply defer to the C library.
+ */
+static const ListAllocator_t __list_libc_allocator = {
+    .alloc = __List__libc_alloc,
+    .free = __List__libc_free,
+    .p_context = NULL
+};
+
+/**
+ * The pointer search kernel picked for this CPU, chosen on first use.
+ */
+static _Atomic(ListPtrFind_t) __list_ptr_find = NULL;
+
+
+
+// Create a new linked list.
+List_t* List__new( size_t max_size ) {
+    return List__new_with_allocator( max_size, NULL );
+}
+
+
+// Create a new linked list whose memory is managed through the given allocator.
+List_t* List__new_with_allocator( size_t max_size, const ListAllocator_t* p_allocator ) {
+    return List__new_with_options( max_size, LIST_FLAGS_NONE, p_allocator );
+}
+
+
+// Create a new linked list with the chosen optional behaviors.
+List_t* List__new_with_flags( size_t max_size, unsigned int flags ) {
+    return List__new_with_options( max_size, flags, NULL );
+}
+
+
+// Create a new linked list with the chosen optional behaviors and allocator.
+List_t* List__new_with_options(
+    size_t max_size,
+    unsigned int flags,
+    const ListAllocator_t* p_allocator
+) {
+    if ( NULL == p_allocator )
+        p_allocator = &__list_libc_allocator;
+
+    if (
+           NULL == p_allocator->alloc
+        || NULL == p_allocator->free
+        || 0 != (flags & ~((unsigned int)(LIST_DOUBLY_LINKED | LIST_INDEXED | LIST_HASHED | LIST_EXCLUSIVE_MODES | LIST_COPY_ON_WRITE)))
+    )  return NULL;
+
+    // Skip index towers are written into the nodes, which copy-on-write lists must not do.
+    if (  (flags & LIST_COPY_ON_WRITE) && (flags & LIST_INDEXED)  )
+        return NULL;
+
+    // First-occurrence removal through the hash needs each node's predecessor.
+    if ( flags & LIST_HASHED )
+        flags |= LIST_DOUBLY_LINKED;
+
+    // Concurrent and unrolled modes manage their own nodes and can't keep any other
+    //   structures current.
+    if (
+           (flags & LIST_EXCLUSIVE_MODES)
+        && LIST_CONCURRENT_STACK != flags
+        && LIST_CONCURRENT_QUEUE != flags
+        && LIST_SPSC_RING != flags
+        && LIST_UNROLLED != flags
+    )  return NULL;
+
+    // Rings are allocated up-front, so they need a real bound.
+    if (  (flags & LIST_SPSC_RING) && (0 == max_size || max_size > ((SIZE_MAX / 2) / sizeof(void*)))  )
+        return NULL;
+
+    if ( 0 == max_size )
+        max_size = __list_size_max_limit;
+
+    List_t* p_list = (List_t*)(*(p_allocator->alloc))( sizeof(List_t), p_allocator->p_context );
+    if ( NULL == p_list )  return NULL;
+
+    p_list->allocator = *p_allocator;
+
+    p_list->head = NULL;
+    p_list->tail = NULL;
+    p_list->count = 0;
+    p_list->max_size = max_size;
+    p_list->flags = flags;
+    p_list->p_share = NULL;
+    p_list->p_finger = NULL;
+    p_list->finger_index = 0;
+
+    memset( &(p_list->pool), 0, sizeof(ListNodePool_t) );
+    p_list->pool.node_size = (flags & LIST_DOUBLY_LINKED)
+        ? sizeof(ListDoubleNode_t)
+        : sizeof(ListNode_t);
+    if ( flags & LIST_CONCURRENT_QUEUE )
+        p_list->pool.node_size = sizeof(ListQueueNode_t);
+    if ( flags & LIST_UNROLLED )
+        p_list->pool.node_size = sizeof(ListUnrolledNode_t);
+
+    // Indexed lists give every node a trailing tower pointer and own a skip index header.
+    p_list->p_index = NULL;
+    if ( flags & LIST_INDEXED ) {
+        p_list->pool.node_size += sizeof(ListSkipTower_t*);
+
+        p_list->p_index = (ListSkipIndex_t*)LIST_ALLOC( p_list, sizeof(ListSkipIndex_t) );
+        if ( NULL == p_list->p_index ) {
+            (*(p_allocator->free))( p_list, p_allocator->p_context );
+            return NULL;
+        }
+
+        memset( p_list->p_index, 0, sizeof(ListSkipIndex_t) );
+        p_list->p_index->seed = __list_skip_seed;
+    }
+
+    // Hashed lists own an empty pointer hash; its slots are allocated on first use.
+    p_list->p_hash = NULL;
+    if ( flags & LIST_HASHED ) {
+        p_list->p_hash = (ListHashIndex_t*)LIST_ALLOC( p_list, sizeof(ListHashIndex_t) );
+        if ( NULL == p_list->p_hash ) {
+            LIST_FREE( p_list, p_list->p_index );
+            (*(p_allocator->free))( p_list, p_allocator->p_context );
+            return NULL;
+        }
+
+        memset( p_list->p_hash, 0, sizeof(ListHashIndex_t) );
+    }
+
+    // Concurrent lists share their state through a separate, cache-line-padded block. A
+    //   queue starts out with a dummy node, which already needs the node pool.
+    p_list->p_concurrent = NULL;
+    if ( flags & (LIST_CONCURRENT_STACK | LIST_CONCURRENT_QUEUE) ) {
+        p_list->p_concurrent = (ListConcurrent_t*)LIST_ALLOC( p_list, sizeof(ListConcurrent_t) );
+        if ( NULL == p_list->p_concurrent ) {
+            (*(p_allocator->free))( p_list, p_allocator->p_context );
+            return NULL;
+        }
+
+        atomic_init( &(p_list->p_concurrent->max_size), max_size );
+        pthread_mutex_init( &(p_list->p_concurrent->grow_lock), NULL );
+
+        if ( !__List__concurrent_reset( p_list ) ) {
+            __List__pool_release( p_list );
+            pthread_mutex_destroy( &(p_list->p_concurrent->grow_lock) );
+            LIST_FREE( p_list, p_list->p_concurrent );
+            (*(p_allocator->free))( p_list, p_allocator->p_context );
+            return NULL;
+        }
+    }
+
+    // Rings get all of their slots at once, rounded up to a power of two for masking.
+    p_list->p_block = NULL;
+    p_list->block_size = 0;
+
+    p_list->p_ring = NULL;
+    if ( flags & LIST_SPSC_RING ) {
+        size_t capacity = 1;
+        while ( capacity < max_size )  capacity <<= 1;
+
+        p_list->p_ring = (ListRing_t*)LIST_ALLOC( p_list, sizeof(ListRing_t) );
+        void** slots = (void**)LIST_ALLOC( p_list, (capacity * sizeof(void*)) );
+        if (  NULL == p_list->p_ring || NULL == slots  ) {
+            LIST_FREE( p_list, slots );
+            LIST_FREE( p_list, p_list->p_ring );
+            (*(p_allocator->free))( p_list, p_allocator->p_context );
+            return NULL;
+        }
+
+        memset( p_list->p_ring, 0, sizeof(ListRing_t) );
+        atomic_init( &(p_list->p_ring->head), 0 );
+        atomic_init( &(p_list->p_ring->tail), 0 );
+        atomic_init( &(p_list->p_ring->max_size), max_size );
+        p_list->p_ring->mask = capacity - 1;
+        p_list->p_ring->slots = slots;
+    }
+
+    return p_list;
+}
+
+
+// Shallow deletion of list elements and the list allocation itself.
+void List__delete_shallow( List_t** pp_list ) {
+    if ( NULL == *pp_list )  return;
+
+    List__clear_shallow( *pp_list );
+    __List__pool_release( *pp_list );
+    LIST_FREE( *pp_list, (*pp_list)->p_index );
+    if ( NULL != (*pp_list)->p_hash ) {
+        LIST_FREE( *pp_list, (*pp_list)->p_hash->slots );
+        LIST_FREE( *pp_list, (*pp_list)->p_hash );
+    }
+    if ( NULL != (*pp_list)->p_concurrent ) {
+        pthread_mutex_destroy( &((*pp_list)->p_concurrent->grow_lock) );
+        LIST_FREE( *pp_list, (*pp_list)->p_concurrent );
+    }
+    if ( NULL != (*pp_list)->p_ring ) {
+        LIST_FREE( *pp_list, (*pp_list)->p_ring->slots );
+        LIST_FREE( *pp_list, (*pp_list)->p_ring );
+    }
+    LIST_FREE( *pp_list, (*pp_list)->p_block );
+
+    // The list's own allocator must be copied out before it frees the List_t holding it.
+    ListAllocator_t allocator = (*pp_list)->allocator;
+    (*(allocator.free))( *pp_list, allocator.p_context );
+    *pp_list = NULL;
+
+    return;
+}
+
+
+// Deeply delete all list nodes and the list pointer.
+void List__delete_deep( List_t** pp_list ) {
+    if ( NULL == *pp_list )  return;
+
+    List__clear_deep( *pp_list );
+    __List__pool_release( *pp_list );
+    LIST_FREE( *pp_list, (*pp_list)->p_index );
+    if ( NULL != (*pp_list)->p_hash ) {
+        LIST_FREE( *pp_list, (*pp_list)->p_hash->slots );
+        LIST_FREE( *pp_list, (*pp_list)->p_hash );
+    }
+    if ( NULL != (*pp_list)->p_concurrent ) {
+        pthread_mutex_destroy( &((*pp_list)->p_concurrent->grow_lock) );
+        LIST_FREE( *pp_list, (*pp_list)->p_concurrent );
+    }
+    if ( NULL != (*pp_list)->p_ring ) {
+        LIST_FREE( *pp_list, (*pp_list)->p_ring->slots );
+        LIST_FREE( *pp_list, (*pp_list)->p_ring );
+    }
+    LIST_FREE( *pp_list, (*pp_list)->p_block );
+
+    // The list's own allocator must be copied out before it frees the List_t holding it.
+    ListAllocator_t allocator = (*pp_list)->allocator;
+    (*(allocator.free))( *pp_list, allocator.p_context );
+    *pp_list = NULL;
+
+    return;
+}
+
+
+// Reverse a linked-list in place.
+void List__reverse( List_t** pp_list ) {
+    if ( NULL == pp_list )  return;
+    if (  NULL != *pp_list && ((*pp_list)->flags & LIST_UNROLLED)  ) {
+        __List__unrolled_reverse( *pp_list );
+        return;
+    }
+    LIST_REFUSE_CONCURRENT( *pp_list, );
+
+    List_t* p_target = *pp_list;
+    if (  List__length( p_target ) < 2  )  return;
+
+    // Relinking the nodes in place keeps the same List_t, so the pointer stays untouched.
+    List__reverse_range( p_target, 0, (p_target->count - 1) );
+    return;
+}
+
+
+// Reverse the order of the nodes between two inclusive indices by relinking them.
+int List__reverse_range( List_t* p_list, size_t from_index, size_t to_index ) {
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+    LIST_UNSHARE( p_list, -1 );
+
+    if (
+           NULL == p_list
+        || from_index > to_index
+        || to_index >= p_list->count
+    )  return -1;
+
+    size_t span = (to_index - from_index) + 1;
+    if ( 1 == span )  return 1;
+
+    // Unrolled nodes hold their elements in slots, so those are swapped in place instead.
+    if ( p_list->flags & LIST_UNROLLED ) {
+        __List__unrolled_reverse_range( p_list, from_index, to_index );
+        return (int)span;
+    }
+
+    // Remember the node just outside each end of the range.
+    ListNode_t* p_before = (0 == from_index)
+        ? NULL
+        : __List__get_node_at( p_list, (from_index - 1) );
+    ListNode_t* p_first = (NULL == p_before) ? p_list->head : p_before->next;
+
+    // Flip each 'next' pointer in the range to point backward. In doubly-linked lists, each
+    //   'prev' pointer is flipped to point forward at the same time.
+    ListNode_t* p_reversed = NULL;
+    ListNode_t* p_scroll = p_first;
+    for ( size_t x = 0; x < span; x++ ) {
+        ListNode_t* p_next = p_scroll->next;
+
+        p_scroll->next = p_reversed;
+        if ( p_list->flags & LIST_DOUBLY_LINKED )
+            LIST_NODE_PREV( p_scroll ) = p_next;
+
+        p_reversed = p_scroll;
+        p_scroll = p_next;
+    }
+
+    // Stitch the reversed run back between the surrounding nodes. The old first node of
+    //   the range is now its last, and 'p_scroll' is the node following the range.
+    p_first->next = p_scroll;
+    if (  (p_list->flags & LIST_DOUBLY_LINKED) && NULL != p_scroll  )
+        LIST_NODE_PREV( p_scroll ) = p_first;
+
+    if ( NULL == p_before )
+        p_list->head = p_reversed;
+    else
+        p_before->next = p_reversed;
+
+    if ( p_list->flags & LIST_DOUBLY_LINKED )
+        LIST_NODE_PREV( p_reversed ) = p_before;
+
+    if ( NULL == p_scroll )
+        p_list->tail = p_first;
+
+    __List__invalidate_positions( p_list );
+
+    return (int)span;
+}
+
+
+// Sort a linked list in place by relinking its nodes with a bottom-up merge sort.
+int List__sort( List_t* p_list, int (*cmp)(const void*, const void*) ) {
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+    LIST_UNSHARE( p_list, -1 );
+
+    if ( NULL == p_list || NULL == cmp )  return -1;
+    if ( p_list->count < 2 )  return (int)p_list->count;
+
+    if ( p_list->flags & LIST_UNROLLED )
+        return __List__unrolled_sort( p_list, cmp );
+
+    ListNode_t* p_tail = NULL;
+    ListNode_t* p_head = __List__sort_chain( p_list->head, cmp, &p_tail );
+    __List__sort_finish( p_list, p_head, p_tail );
+
+    return (int)p_list->count;
+}
+
+
+// Sort a linked list in place, splitting the work across several threads.
+int List__sort_parallel( List_t* p_list, int (*cmp)(const void*, const void*), size_t nthreads ) {
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+    LIST_UNSHARE( p_list, -1 );
+
+    if ( NULL == p_list || NULL == cmp )  return -1;
+
+    // Unrolled lists sort an array of their data pointers, which one thread does quickly.
+    if ( p_list->flags & LIST_UNROLLED )
+        return List__sort( p_list, cmp );
+
+    // Don't bother with threads for runs which would sort faster than a thread starts.
+    size_t runs = p_list->count / __list_sort_parallel_min_run;
+    if ( nthreads < runs )  runs = nthreads;
+    if ( runs < 2 )  return List__sort( p_list, cmp );
+
+    ListSortJob_t* p_jobs = (ListSortJob_t*)LIST_ALLOC( p_list, runs * sizeof(ListSortJob_t) );
+    pthread_t* p_threads = (pthread_t*)LIST_ALLOC( p_list, runs * sizeof(pthread_t) );
+    bool* p_started = (bool*)LIST_ALLOC( p_list, runs * sizeof(bool) );
+    if ( NULL == p_jobs || NULL == p_threads || NULL == p_started ) {
+        LIST_FREE( p_list, p_jobs );
+        LIST_FREE( p_list, p_threads );
+        LIST_FREE( p_list, p_started );
+        return List__sort( p_list, cmp );
+    }
+
+    // Cut the chain into contiguous runs of (nearly) equal length, keeping their order.
+    ListNode_t* p_node = p_list->head;
+    for ( size_t x = 0; x < runs; x++ ) {
+        size_t length = (p_list->count / runs) + ((x < (p_list->count % runs)) ? 1 : 0);
+
+        p_jobs[x].p_head = p_node;
+        p_jobs[x].p_right = NULL;
+        p_jobs[x].cmp = cmp;
+
+        for ( size_t y = 1; y < length; y++ )
+            p_node = p_node->next;
+
+        ListNode_t* p_next = p_node->next;
+        p_node->next = NULL;
+        p_node = p_next;
+    }
+
+    // Sort every run but the first on its own thread, and the first one on this thread.
+    //   A run whose thread can't be started is sorted here too once the others are going.
+    for ( size_t x = 1; x < runs; x++ )
+        p_started[x] = (0 == pthread_create( &p_threads[x], NULL, __List__sort_worker, &p_jobs[x] ));
+
+    __List__sort_worker( &p_jobs[0] );
+    for ( size_t x = 1; x < runs; x++ ) {
+        if ( p_started[x] )
+            pthread_join( p_threads[x], NULL );
+        else
+            __List__sort_worker( &p_jobs[x] );
+    }
+
+    // Merge neighboring runs pairwise, each pair on its own thread, until one run is left.
+    //   The left run of a pair always holds the earlier nodes, which keeps the result stable.
+    for ( size_t step = 1; step < runs; step *= 2 ) {
+        for ( size_t x = 0; (x + step) < runs; x += (2 * step) ) {
+            p_jobs[x].p_right = p_jobs[x + step].p_head;
+            p_started[x] = (x > 0)
+                && (0 == pthread_create( &p_threads[x], NULL, __List__merge_worker, &p_jobs[x] ));
+        }
+
+        for ( size_t x = 0; (x + step) < runs; x += (2 * step) ) {
+            if ( p_started[x] )
+                pthread_join( p_threads[x], NULL );
+            else
+                __List__merge_worker( &p_jobs[x] );
+        }
+    }
+
+    __List__sort_finish( p_list, p_jobs[0].p_head, p_jobs[0].p_tail );
+
+    LIST_FREE( p_list, p_jobs );
+    LIST_FREE( p_list, p_threads );
+    LIST_FREE( p_list, p_started );
+
+    return (int)p_list->count;
+}
+
+
+// Shrink or grow a list capacity to the given max_size. If the linked list contains more
+//   elements than the new max_size, an error is returned. Otherwise, return the new max.
+size_t List__resize( List_t* p_list, size_t new_max_size ) {
+    if (  NULL == p_list || new_max_size < List__length( p_list )  )  return 0;
+
+    // A ring can't outgrow the slots it was created with.
+    if (
+           NULL != p_list->p_ring
+        && (0 == new_max_size || new_max_size > (p_list->p_ring->mask + 1))
+    )  return 0;
+
+    p_list->max_size = (0 == new_max_size)
+        ? __list_size_max_limit
+        : new_max_size;
+
+    if ( NULL != p_list->p_concurrent )
+        atomic_store( &(p_list->p_concurrent->max_size), p_list->max_size );
+    if ( NULL != p_list->p_ring )
+        atomic_store( &(p_list->p_ring->max_size), p_list->max_size );
+
+    return new_max_size;
+}
+
+
+// Wrapper method to get max_size property.
+size_t List__get_max_size( List_t* p_list ) {
+    return (NULL == p_list) ? 0 : p_list->max_size;
+}
+
+
+// Shallowly delete a linked list structure, but not the underlying resources.
+//   The node pool keeps all of its chunks so the list can be refilled without allocating.
+void List__clear_shallow( List_t* p_list ) {
+    if ( NULL == p_list )  return;
+
+    // Shared nodes are simply let go of; they were never in this list's pool.
+    __List__share_release( p_list );
+
+    // Towers live outside of the pool and must be released first.
+    if ( NULL != p_list->p_index )
+        __List__skip_drop_towers( p_list );
+    if ( NULL != p_list->p_hash )
+        __List__hash_reset( p_list );
+
+    // Every node lives in the pool, so resetting it drops all nodes at once.
+    __List__pool_reset( p_list );
+
+    // The pool keeps its chunks, so a queue's new dummy node can't fail to be allocated.
+    if ( NULL != p_list->p_concurrent )
+        __List__concurrent_reset( p_list );
+
+    if ( NULL != p_list->p_ring ) {
+        atomic_store( &(p_list->p_ring->head), 0 );
+        atomic_store( &(p_list->p_ring->tail), 0 );
+        p_list->p_ring->cached_head = p_list->p_ring->cached_tail = 0;
+    }
+
+    p_list->head = NULL;
+    p_list->tail = NULL;
+    p_list->count = 0;
+    p_list->p_finger = NULL;
+}
+
+
+// Deeply free all held list resources.
+void List__clear_deep( List_t* p_list ) {
+    if ( NULL == p_list )  return;
+
+    // The chain of a concurrent stack hangs off its tagged top instead of the HEAD, and a
+    //   concurrent queue's chain follows its dummy node.
+    ListNode_t* p_node = p_list->head;
+    if ( p_list->flags & LIST_CONCURRENT_STACK )
+        p_node = __List__tagged_ptr( atomic_load( &(p_list->p_concurrent->top) ) );
+
+    if ( p_list->flags & LIST_CONCURRENT_QUEUE ) {
+        ListQueueNode_t* p_dummy = __List__tagged_ptr( atomic_load( &(p_list->p_concurrent->top) ) );
+
+        for (
+            ListQueueNode_t* p_queued = __List__tagged_ptr( atomic_load( &(p_dummy->next) ) );
+            NULL != p_queued;
+            p_queued = __List__tagged_ptr( atomic_load( &(p_queued->next) ) )
+        )  LIST_FREE( p_list, atomic_load( &(p_queued->data) ) );
+    }
+
+    if ( NULL != p_list->p_ring ) {
+        ListRing_t* p_ring = p_list->p_ring;
+        for ( size_t x = atomic_load( &(p_ring->head) ); x != atomic_load( &(p_ring->tail) ); x++ )
+            LIST_FREE( p_list, p_ring->slots[x & p_ring->mask] );
+
+        atomic_store( &(p_ring->head), 0 );
+        atomic_store( &(p_ring->tail), 0 );
+        p_ring->cached_head = p_ring->cached_tail = 0;
+    }
+
+    // Elements inside an owned block are released all at once with the block.
+    uintptr_t block_start = (uintptr_t)p_list->p_block;
+    uintptr_t block_end = block_start + p_list->block_size;
+
+    if ( p_list->flags & LIST_UNROLLED ) {
+        for ( ListUnrolledNode_t* p_unrolled = LIST_UNROLLED_HEAD( p_list ); NULL != p_unrolled; p_unrolled = p_unrolled->next ) {
+            for ( size_t x = 0; x < p_unrolled->used; x++ ) {
+                if (  (uintptr_t)p_unrolled->data[x] < block_start || (uintptr_t)p_unrolled->data[x] >= block_end  )
+                    LIST_FREE( p_list, p_unrolled->data[x] );
+            }
+        }
+        p_node = NULL;
+    }
+
+    while ( NULL != p_node ) {
+        // This is the only real difference between shallow and deep clears.
+        //   It's OK to free a NULL ptr per the 'free' man-page.
+        if (  (uintptr_t)p_node->data < block_start || (uintptr_t)p_node->data >= block_end  )
+            LIST_FREE( p_list, p_node->data );
+
+        p_node = p_node->next;
+    }
+
+    LIST_FREE( p_list, p_list->p_block );
+    p_list->p_block = NULL;
+    p_list->block_size = 0;
+
+    if ( NULL != p_list->p_index )
+        __List__skip_drop_towers( p_list );
+    if ( NULL != p_list->p_hash )
+        __List__hash_reset( p_list );
+
+    __List__share_release( p_list );
+    __List__pool_reset( p_list );
+
+    if ( NULL != p_list->p_concurrent )
+        __List__concurrent_reset( p_list );
+
+    p_list->head = NULL;
+    p_list->tail = NULL;
+    p_list->count = 0;
+    p_list->p_finger = NULL;
+}
+
+
+// Release node pool chunks which no longer hold any live nodes.
+size_t List__shrink_to_fit( List_t* p_list ) {
+    LIST_REFUSE_CONCURRENT( p_list, p_list->pool.capacity );
+
+    if ( NULL == p_list )  return 0;
+
+    ListNodePool_t* p_pool = &(p_list->pool);
+
+    // A shared list's live nodes belong to its share, so its own pool has none to keep.
+    if ( NULL != p_list->p_share )  return p_pool->capacity;
+
+    // Nothing is linked, so nothing needs to be preserved.
+    if ( 0 == p_list->count ) {
+        __List__pool_release( p_list );
+        return 0;
+    }
+
+    size_t chunk_count = 0;
+    for ( ListNodeChunk_t* p_chunk = p_pool->chunks; NULL != p_chunk; p_chunk = p_chunk->next )
+        chunk_count++;
+
+    // Sort the chunks by address so the owner of each live node can be found by bisection.
+    //   The chunk's 'used' field is borrowed as a live-node counter while the array exists.
+    ListNodeChunk_t** pp_sorted = (ListNodeChunk_t**)LIST_ALLOC( p_list, chunk_count * sizeof(ListNodeChunk_t*) );
+    size_t* p_used = (size_t*)LIST_ALLOC( p_list, chunk_count * sizeof(size_t) );
+    if ( NULL == pp_sorted || NULL == p_used ) {
+        LIST_FREE( p_list, pp_sorted );
+        LIST_FREE( p_list, p_used );
+        return p_pool->capacity;
+    }
+
+    size_t x = 0;
+    for ( ListNodeChunk_t* p_chunk = p_pool->chunks; NULL != p_chunk; p_chunk = p_chunk->next )
+        pp_sorted[x++] = p_chunk;
+    qsort( pp_sorted, chunk_count, sizeof(ListNodeChunk_t*), __List__chunk_compare );
+
+    for ( x = 0; x < chunk_count; x++ ) {
+        p_used[x] = pp_sorted[x]->used;
+        pp_sorted[x]->used = 0;
+    }
+
+    if ( p_list->flags & LIST_UNROLLED ) {
+        for ( ListUnrolledNode_t* p_unrolled = LIST_UNROLLED_HEAD( p_list ); NULL != p_unrolled; p_unrolled = p_unrolled->next )
+            __List__chunk_owner( pp_sorted, chunk_count, p_unrolled )->used++;
+    } else {
+        for ( ListNode_t* p_node = p_list->head; NULL != p_node; p_node = p_node->next )
+            __List__chunk_owner( pp_sorted, chunk_count, p_node )->used++;
+    }
+
+    // Drop any free-list entries living in chunks which are about to be released.
+    ListNode_t** pp_free = &(p_pool->free_nodes);
+    while ( NULL != *pp_free ) {
+        if ( 0 == __List__chunk_owner( pp_sorted, chunk_count, *pp_free )->used )
+            *pp_free = (*pp_free)->next;
+        else
+            pp_free = &((*pp_free)->next);
+    }
+
+    // Restore the bump counters of the surviving chunks, then unlink and free the rest.
+    for ( x = 0; x < chunk_count; x++ ) {
+        if ( 0 != pp_sorted[x]->used )
+            pp_sorted[x]->used = p_used[x];
+    }
+
+    ListNodeChunk_t** pp_chunk = &(p_pool->chunks);
+    p_pool->current = NULL;
+    while ( NULL != *pp_chunk ) {
+        ListNodeChunk_t* p_chunk = *pp_chunk;
+
+        if ( 0 == p_chunk->used ) {
+            *pp_chunk = p_chunk->next;
+            p_pool->capacity -= p_chunk->capacity;
+            LIST_FREE( p_list, p_chunk );
+        } else {
+            p_pool->current = p_chunk;
+            pp_chunk = &(p_chunk->next);
+        }
+    }
+
+    LIST_FREE( p_list, pp_sorted );
+    LIST_FREE( p_list, p_used );
+
+    return p_pool->capacity;
+}
+
+
+// Move every node into a single new chunk in list order, releasing all old node memory.
+int List__compact( List_t* p_list ) {
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+    LIST_UNSHARE( p_list, -1 );
+
+    if ( NULL == p_list )  return -1;
+
+    ListNodePool_t* p_pool = &(p_list->pool);
+
+    if ( 0 == p_list->count ) {
+        __List__pool_release( p_list );
+        return 0;
+    }
+
+    if ( p_list->flags & LIST_UNROLLED )
+        return __List__unrolled_compact( p_list );
+
+    ListNodeChunk_t* p_chunk = (ListNodeChunk_t*)LIST_ALLOC(
+        p_list, sizeof(ListNodeChunk_t) + (p_list->count * p_pool->node_size) );
+    if ( NULL == p_chunk )  return -1;
+
+    p_chunk->next = NULL;
+    p_chunk->capacity = p_list->count;
+    p_chunk->used = p_list->count;
+
+    // Copy each node whole (keeping its data and tower pointers) and relink the copies.
+    char* p_slot = (char*)(p_chunk + 1);
+    ListNode_t* p_prev = NULL;
+    for ( ListNode_t* p_node = p_list->head; NULL != p_node; p_node = p_node->next, p_slot += p_pool->node_size ) {
+        ListNode_t* p_moved = (ListNode_t*)p_slot;
+        memcpy( p_moved, p_node, p_pool->node_size );
+
+        if ( NULL == p_prev )
+            p_list->head = p_moved;
+        else
+            p_prev->next = p_moved;
+
+        if ( p_list->flags & LIST_DOUBLY_LINKED )
+            LIST_NODE_PREV( p_moved ) = p_prev;
+
+        p_prev = p_moved;
+    }
+
+    p_prev->next = NULL;
+    p_list->tail = p_prev;
+
+    __List__pool_release( p_list );
+    p_pool->chunks = p_pool->current = p_chunk;
+    p_pool->capacity = p_chunk->capacity;
+
+    // Express lanes and hash entries still point at the old nodes. Marking them stale
+    //   makes the next use rebuild them; the towers come along with the nodes, so the
+    //   rebuild's chain walk can still release them.
+    if ( NULL != p_list->p_index )
+        p_list->p_index->dirty = true;
+    if ( NULL != p_list->p_hash )
+        p_list->p_hash->dirty = true;
+    p_list->p_finger = NULL;
+
+    return (int)p_list->count;
+}
+
+
+// Add an item onto the tail of a linked list.
+int List__add( List_t* p_list, void* p_data ) {
+    if (  NULL != p_list && (p_list->flags & LIST_CONCURRENT_QUEUE)  )
+        return __List__queue_enqueue( p_list, p_data );
+    if (  NULL != p_list && NULL != p_list->p_ring  )
+        return __List__ring_add_many( p_list, &p_data, 1 );
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  )
+        return __List__unrolled_insert( p_list, p_data, p_list->count );
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+    LIST_UNSHARE( p_list, -1 );
+
+    if (
+           NULL == p_list
+        || ((p_list->count + 1) > p_list->max_size)
+    )  return -1;
+
+    // Init the new list node with the referenced data pointer.
+    ListNode_t* p_new_node = LIST_NODE_INITIALIZER( p_list );
+    if ( NULL == p_new_node )  return -1;
+    p_new_node->data = p_data;
+
+    // Hook the node onto the tail directly; an empty list simply gets a new head.
+    __List__link_node_after( p_list, p_list->tail, p_new_node, p_list->count );
+
+    // Return the place of the new node, which is just the new list length.
+    return p_list->count;
+}
+
+
+// Add a batch of items onto the tail of a linked list, all or nothing.
+int List__add_many( List_t* p_list, void** pp_data, size_t count ) {
+    if (  NULL == p_list || (NULL == pp_data && 0 != count)  )  return -1;
+
+    if ( NULL != p_list->p_ring )
+        return __List__ring_add_many( p_list, pp_data, count );
+    if ( p_list->flags & LIST_UNROLLED )
+        return __List__unrolled_insert_many( p_list, pp_data, count, false );
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+    LIST_UNSHARE( p_list, -1 );
+
+    if ( count > (p_list->max_size - p_list->count) )  return -1;
+    if ( 0 == count )  return p_list->count;
+
+    ListNode_t* p_last = NULL;
+    ListNode_t* p_first = __List__chain_build( p_list, pp_data, NULL, count, false, &p_last );
+    if ( NULL == p_first )  return -1;
+
+    __List__chain_link_after( p_list, p_list->tail, p_list->count, p_first, p_last, count );
+
+    return p_list->count;
+}
+
+
+// Add an item to a linked list somewhere in its chain of nodes.
+int List__add_at( List_t* p_list, void* p_data, size_t index ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  ) {
+        int res = __List__unrolled_insert( p_list, p_data, index );
+        return (-1 == res) ? -1 : (int)index;
+    }
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+    LIST_UNSHARE( p_list, -1 );
+
+    if (
+           NULL == p_list
+        || (p_list->count + 1) > p_list->max_size
+        || index > p_list->count   // if len == 3, and list has 0,1,2; this is ok
+    )  return -1;
+
+    // If the new location is head, just insert it and be done; no looping.
+    if ( 0 == index ) {
+        if (  -1 == List__push( p_list, p_data )  )  return -1;
+        return index;
+    } else if ( p_list->count == index ) {
+        return List__add( p_list, p_data );
+    }
+
+    // Get the preceding list node.
+    ListNode_t* p_node_before = __List__get_node_at( p_list, (index-1) );
+
+    // Create the new node.
+    ListNode_t* p_new_node = LIST_NODE_INITIALIZER( p_list );
+    if ( NULL == p_new_node )  return -1;
+    p_new_node->data = p_data;
+
+    // Insert the new node.
+    __List__link_node_after( p_list, p_node_before, p_new_node, index );
+
+    // Return the index to indicate success.
+    return index;
+}
+
+
+// Staple the src linked list to the end of the dest linked list.
+int List__extend( List_t* p_list_dest, List_t* p_list_src ) {
+    LIST_REFUSE_CONCURRENT( p_list_dest, -1 );
+    LIST_REFUSE_CONCURRENT( p_list_src, -1 );
+    LIST_UNSHARE( p_list_dest, -1 );
+
+    if ( NULL == p_list_dest )  return -1;
+
+    size_t dest_len = p_list_dest->count;
+    size_t src_len = List__length( p_list_src );
+
+    if (  (dest_len + src_len) > p_list_dest->max_size  )  return -1;
+
+    // Nothing to add.
+    if (  NULL == p_list_src || 0 == src_len  )
+        return dest_len;
+
+    if (  (p_list_dest->flags | p_list_src->flags) & LIST_UNROLLED  )
+        return __List__insert_list_at( p_list_dest, dest_len, p_list_src, 0, src_len );
+
+    // Copy the source into a detached chain first. The walk is bounded by the original
+    //   source count and nothing is linked until it's done, so a list can safely be
+    //   extended by itself, and a failure leaves the destination untouched.
+    ListNode_t* p_last = NULL;
+    ListNode_t* p_first = __List__chain_build( p_list_dest, NULL, p_list_src->head, src_len, false, &p_last );
+    if ( NULL == p_first )  return -1;
+
+    __List__chain_link_after( p_list_dest, p_list_dest->tail, dest_len, p_first, p_last, src_len );
+
+    // Return new destination linked list length.
+    return p_list_dest->count;
+}
+
+
+// Extend the destination list and shallowly free the source.
+int List__merge( List_t* p_list_dest, List_t* p_list_src ) {
+    return List__merge_at( p_list_dest, p_list_src, List__length( p_list_dest ) );
+}
+
+
+// Insert the src linked list into the dest linked list at the index.
+int List__extend_at( List_t* p_list_dest, List_t* p_list_src, size_t index ) {
+    LIST_REFUSE_CONCURRENT( p_list_dest, -1 );
+    LIST_REFUSE_CONCURRENT( p_list_src, -1 );
+    LIST_UNSHARE( p_list_dest, -1 );
+
+    if ( NULL == p_list_dest )  return -1;
+
+    size_t dest_len = p_list_dest->count;
+    size_t src_len = List__length( p_list_src );
+
+    if (
+           (dest_len + src_len) > p_list_dest->max_size
+        || index > dest_len   // can be the new tail index, so 3 from 0,1,2 (len3)
+    )  return -1;
+
+    // Nothing to add.
+    if (  NULL == p_list_src || 0 == src_len  )
+        return dest_len;
+
+    if (  (p_list_dest->flags | p_list_src->flags) & LIST_UNROLLED  )
+        return __List__insert_list_at( p_list_dest, index, p_list_src, 0, src_len );
+
+    // Appending onto the tail is just a regular extension.
+    if ( dest_len == index )
+        return List__extend( p_list_dest, p_list_src );
+
+    // Save the node preceding the insertion point; NULL means the insertion is at HEAD.
+    ListNode_t* p_node_before = (0 == index)
+        ? NULL
+        : __List__get_node_at( p_list_dest, (index-1) );
+
+    // Like extending, the copy is detached until it's complete.
+    ListNode_t* p_last = NULL;
+    ListNode_t* p_first = __List__chain_build( p_list_dest, NULL, p_list_src->head, src_len, false, &p_last );
+    if ( NULL == p_first )  return -1;
+
+    __List__chain_link_after( p_list_dest, p_node_before, index, p_first, p_last, src_len );
+
+    // Return new destination linked list length.
+    return p_list_dest->count;
+}
+
+
+// Extend the destination list at the chosen index and shallowly free the source.
+int List__merge_at( List_t* p_list_dest, List_t* p_list_src, size_t index ) {
+    LIST_UNSHARE( p_list_dest, -1 );
+
+    // The source's nodes are consumed anyway, so hand them over when they fit.
+    if ( __List__can_move_nodes( p_list_dest, p_list_src ) )
+        return __List__move_nodes( p_list_dest, p_list_src, index );
+
+    int ext_res = List__extend_at( p_list_dest, p_list_src, index );
+
+    if ( -1 != ext_res )
+        List__clear_shallow( p_list_src );
+
+    return ext_res;
+}
+
+
+// Move an inclusive range of elements from one list into another.
+int List__splice_range(
+    List_t* p_list_dest,
+    size_t index,
+    List_t* p_list_src,
+    size_t from_index,
+    size_t to_index
+) {
+    LIST_REFUSE_CONCURRENT( p_list_dest, -1 );
+    LIST_REFUSE_CONCURRENT( p_list_src, -1 );
+    LIST_UNSHARE( p_list_dest, -1 );
+    LIST_UNSHARE( p_list_src, -1 );
+
+    if (
+           NULL == p_list_dest
+        || NULL == p_list_src
+        || p_list_dest == p_list_src
+        || from_index > to_index
+        || to_index >= p_list_src->count
+        || index > p_list_dest->count
+    )  return -1;
+
+    size_t count = (to_index - from_index) + 1;
+    if ( count > (p_list_dest->max_size - p_list_dest->count) )  return -1;
+
+    // The whole list can simply be merged over.
+    if (  count == p_list_src->count && __List__can_move_nodes( p_list_dest, p_list_src )  )
+        return __List__move_nodes( p_list_dest, p_list_src, index );
+
+    // Unrolled nodes can't be relinked one element at a time, so the range's data pointers
+    //   are copied over and then removed from the source in a single pass.
+    if (  (p_list_dest->flags | p_list_src->flags) & LIST_UNROLLED  ) {
+        if (  -1 == __List__insert_list_at( p_list_dest, index, p_list_src, from_index, count )  )
+            return -1;
+
+        if ( p_list_src->flags & LIST_UNROLLED ) {
+            __List__unrolled_remove_run( p_list_src, from_index, count );
+        } else {
+            ListNode_t* p_src_prev = (0 == from_index)
+                ? NULL
+                : __List__get_node_at( p_list_src, (from_index - 1) );
+
+            for ( size_t x = 0; x < count; x++ )
+                LIST_NODE_RELEASE(  p_list_src, __List__unlink_node_after( p_list_src, p_src_prev, from_index )  );
+        }
+
+        return p_list_dest->count;
+    }
+
+    // Nodes belong to their list's pool, so a partial range is copied over and then
+    //   unlinked from the source; the copy is detached until it's complete.
+    ListNode_t* p_src_prev = (0 == from_index)
+        ? NULL
+        : __List__get_node_at( p_list_src, (from_index - 1) );
+    ListNode_t* p_src_first = (NULL == p_src_prev) ? p_list_src->head : p_src_prev->next;
+
+    ListNode_t* p_last = NULL;
+    ListNode_t* p_first = __List__chain_build( p_list_dest, NULL, p_src_first, count, false, &p_last );
+    if ( NULL == p_first )  return -1;
+
+    ListNode_t* p_node_before = (0 == index)
+        ? NULL
+        : __List__get_node_at( p_list_dest, (index - 1) );
+    __List__chain_link_after( p_list_dest, p_node_before, index, p_first, p_last, count );
+
+    for ( size_t x = 0; x < count; x++ )
+        LIST_NODE_RELEASE(  p_list_src, __List__unlink_node_after( p_list_src, p_src_prev, from_index )  );
+
+    return p_list_dest->count;
+}
+
+
+// Shallow clone of a linked list's structure. This does not copy underlying data.
+List_t* List__clone( List_t* p_list ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  )
+        return __List__unrolled_clone( p_list );
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+
+    size_t len = List__length( p_list );
+    if ( NULL == p_list || 0 == len )  return NULL;
+
+    if ( p_list->flags & LIST_COPY_ON_WRITE )
+        return __List__share_chain( p_list, p_list->head, p_list->tail, len );
+
+    List_t* p_new = List__new_with_options( p_list->max_size, p_list->flags, &(p_list->allocator) );
+    if ( NULL == p_new )  return NULL;
+
+    // Build the new chain in order, pointing each new node at the source node's data.
+    ListNode_t* p_last = NULL;
+    ListNode_t* p_first = __List__chain_build( p_new, NULL, p_list->head, len, false, &p_last );
+    if ( NULL == p_first ) {
+        List__delete_shallow( &p_new );
+        return NULL;
+    }
+
+    __List__chain_link_after( p_new, NULL, 0, p_first, p_last, len );
+
+    // Return the new List_t shallow clone.
+    return p_new;
+}
+
+
+// Slice a given linked list according to two indices.
+List_t* List__slice( List_t* p_list, size_t from_index, size_t to_index ) {
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+
+    if (
+           NULL == p_list
+        || from_index >= to_index
+        || to_index >= p_list->count
+    )  return NULL;
+
+    size_t len = (to_index - from_index) + 1;
+
+    if ( p_list->flags & LIST_UNROLLED ) {
+        List_t* p_new = List__new_with_options( p_list->max_size, p_list->flags, &(p_list->allocator) );
+        if ( NULL == p_new )  return NULL;
+
+        if (  -1 == __List__insert_list_at( p_new, 0, p_list, from_index, len )  )
+            List__delete_shallow( &p_new );
+
+        return p_new;
+    }
+
+    ListNode_t* p_start = __List__get_node_at( p_list, from_index );
+    if ( NULL == p_start )  return NULL;
+
+    // A suffix of a singly-linked chain is a complete chain of its own.
+    if (
+           (p_list->flags & LIST_COPY_ON_WRITE)
+        && !(p_list->flags & LIST_DOUBLY_LINKED)
+        && to_index == (p_list->count - 1)
+    )  return __List__share_chain( p_list, p_start, p_list->tail, len );
+
+    List_t* p_new = List__new_with_options( p_list->max_size, p_list->flags, &(p_list->allocator) );
+    if ( NULL == p_new )  return NULL;
+
+    // From start to end of the slice, build up the new chain in one go.
+    ListNode_t* p_last = NULL;
+    ListNode_t* p_first = __List__chain_build( p_new, NULL, p_start, len, false, &p_last );
+    if ( NULL == p_first ) {
+        List__delete_shallow( &p_new );
+        return NULL;
+    }
+
+    __List__chain_link_after( p_new, NULL, 0, p_first, p_last, len );
+
+    return p_new;
+}
+
+
+// Deep copy of a linked list. This creates a fully-independent copy of the provided list.
+List_t* List__copy( List_t* p_list, size_t element_size ) {
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+
+    size_t len = List__length( p_list );
+
+    if (
+           NULL == p_list
+        || 0 == len
+        || element_size <= 0
+    )  return NULL;
+
+    List_t* p_new = List__new_with_options( p_list->max_size, p_list->flags, &(p_list->allocator) );
+    if ( NULL == p_new )  return NULL;
+
+    if ( p_list->flags & LIST_UNROLLED ) {
+        for ( ListUnrolledNode_t* p_unrolled = LIST_UNROLLED_HEAD( p_list ); NULL != p_unrolled; p_unrolled = p_unrolled->next ) {
+            for ( size_t x = 0; x < p_unrolled->used; x++ ) {
+                void* p_new_data = LIST_ALLOC( p_new, element_size );
+
+                if (  NULL == p_new_data || -1 == __List__unrolled_insert( p_new, p_new_data, p_new->count )  ) {
+                    if ( NULL != p_new_data )  LIST_FREE( p_new, p_new_data );
+                    List__delete_deep( &p_new );
+                    return NULL;
+                }
+
+                memcpy( p_new_data, p_unrolled->data[x], element_size );
+            }
+        }
+
+        return p_new;
+    }
+
+    ListNode_t* p_scroll = p_list->head;
+    while ( NULL != p_scroll ) {
+        // Allocate a copy of the scroll node's data, as well as a node to hold it.
+        void* p_new_data = LIST_ALLOC( p_new, element_size );
+        ListNode_t* p_new_node = (NULL == p_new_data) ? NULL : LIST_NODE_INITIALIZER( p_new );
+
+        if ( NULL == p_new_node ) {
+            // Free everything copied so far to prevent memory leaks.
+            if ( NULL != p_new_data )  LIST_FREE( p_new, p_new_data );
+            List__delete_deep( &p_new );
+            return NULL;
+        }
+
+        // Set the new data and place the node onto the tail of the copy.
+        memcpy( p_new_data, p_scroll->data, element_size );
+        p_new_node->data = p_new_data;
+        __List__link_node_after( p_new, p_new->tail, p_new_node, p_new->count );
+
+        p_scroll = p_scroll->next;
+    }
+
+    return p_new;
+}
+
+
+// Deep copy of a linked list into one block of nodes and one block of elements.
+List_t* List__copy_contiguous( List_t* p_list, size_t element_size ) {
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+
+    size_t len = List__length( p_list );
+
+    if (
+           NULL == p_list
+        || 0 == len
+        || 0 == element_size
+        || len > (SIZE_MAX / element_size)
+    )  return NULL;
+
+    List_t* p_new = List__new_with_options( p_list->max_size, p_list->flags, &(p_list->allocator) );
+    if ( NULL == p_new )  return NULL;
+
+    // A fresh pool hands out a reservation from a single chunk, in order. Unrolled
+    //   lists only need enough nodes to hold every element.
+    size_t nodes = (p_list->flags & LIST_UNROLLED)
+        ? ((len + LIST_UNROLLED_SLOTS - 1) / LIST_UNROLLED_SLOTS)
+        : len;
+    if ( !__List__pool_reserve( p_new, nodes ) ) {
+        List__delete_shallow( &p_new );
+        return NULL;
+    }
+
+    p_new->p_block = (char*)LIST_ALLOC( p_new, (len * element_size) );
+    if ( NULL == p_new->p_block ) {
+        List__delete_shallow( &p_new );
+        return NULL;
+    }
+    p_new->block_size = len * element_size;
+
+    char* p_element = p_new->p_block;
+    if ( p_list->flags & LIST_UNROLLED ) {
+        for ( ListUnrolledNode_t* p_unrolled = LIST_UNROLLED_HEAD( p_list ); NULL != p_unrolled; p_unrolled = p_unrolled->next ) {
+            for ( size_t x = 0; x < p_unrolled->used; x++, p_element += element_size ) {
+                void* p_new_data = NULL;
+
+                if ( NULL != p_unrolled->data[x] ) {
+                    memcpy( p_element, p_unrolled->data[x], element_size );
+                    p_new_data = p_element;
+                }
+
+                __List__unrolled_insert( p_new, p_new_data, p_new->count );   // can't fail after the reservation
+            }
+        }
+
+        return p_new;
+    }
+
+    for ( ListNode_t* p_scroll = p_list->head; NULL != p_scroll; p_scroll = p_scroll->next, p_element += element_size ) {
+        ListNode_t* p_new_node = LIST_NODE_INITIALIZER( p_new );   // can't fail after the reservation
+
+        if ( NULL != p_scroll->data ) {
+            memcpy( p_element, p_scroll->data, element_size );
+            p_new_node->data = p_element;
+        }
+
+        __List__link_node_after( p_new, p_new->tail, p_new_node, p_new->count );
+    }
+
+    return p_new;
+}
+
+
+// Gets whether the data pointer exists somewhere within the linked list.
+bool List__contains( List_t* p_list, void* p_data ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  )
+        return __List__unrolled_find( p_list, p_data, false, NULL );
+    LIST_REFUSE_CONCURRENT( p_list, false );
+
+    // Hashed lists only need to know whether the pointer has a slot.
+    if (  NULL != p_list && NULL != p_data && NULL != p_list->p_hash  ) {
+        if (  !p_list->p_hash->dirty || __List__hash_rebuild( p_list )  )
+            return (NULL != __List__hash_find( p_list, p_data ));
+    }
+
+    ListNode_t* p_occ = __List__get_node_first_occurrence( p_list, p_data, NULL, NULL );
+
+    return (NULL != p_occ);
+}
+
+
+// Returns 0 if list has content; 1 if no elements.
+bool List__is_empty( List_t* p_list ) {
+    return (0 != List__length( p_list ));
+}
+
+
+// Gets the first data element (HEAD) of the linked list.
+void* List__get_first( List_t* p_list ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  )
+        return List__get_at( p_list, 0 );
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+
+    if ( NULL == p_list || NULL == p_list->head )  return NULL;
+
+    return p_list->head->data;
+}
+
+
+// Gets the final data element (TAIL) of the linked list.
+void* List__get_last( List_t* p_list ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  )
+        return List__get_at( p_list, (p_list->count - 1) );
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+
+    if ( NULL == p_list || NULL == p_list->tail )  return NULL;
+
+    return p_list->tail->data;
+}
+
+
+// Gets the data element at the selected index from the linked list.
+void* List__get_at( List_t* p_list, size_t index ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  ) {
+        size_t slot;
+        ListUnrolledNode_t* p_unrolled = __List__unrolled_seek( p_list, index, &slot );
+        return (NULL == p_unrolled) ? NULL : p_unrolled->data[slot];
+    }
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+
+    ListNode_t* p_node = __List__get_node_at( p_list, index );
+
+    return ( NULL == p_node ) ? NULL : p_node->data;
+}
+
+
+// Returns the 0-based array index of the data pointer.
+int List__index_of( List_t* p_list, void* p_data ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  ) {
+        size_t index;
+        return __List__unrolled_find( p_list, p_data, false, &index ) ? (int)index : -1;
+    }
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+
+    size_t index;
+    ListNode_t* p_node = __List__get_node_first_occurrence( p_list, p_data, NULL, &index );
+
+    return ( NULL == p_node ) ? -1 : (int)index;
+}
+
+
+// Returns the final 0-based array index of the data pointer.
+int List__last_index_of( List_t* p_list, void* p_data ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  ) {
+        size_t index;
+        return __List__unrolled_find( p_list, p_data, true, &index ) ? (int)index : -1;
+    }
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+
+    size_t index;
+    ListNode_t* p_node = __List__get_node_last_occurrence( p_list, p_data, NULL, &index );
+
+    return ( NULL == p_node ) ? -1 : (int)index;
+}
+
+
+// Pop off the current first element (HEAD) of the linked list, free the
+//    node (NOT the data), and return its data pointer.
+void* List__pop( List_t* p_list ) {
+    if (  NULL != p_list && (p_list->flags & LIST_CONCURRENT_STACK)  )
+        return __List__stack_pop( p_list );
+    if (  NULL != p_list && (p_list->flags & LIST_CONCURRENT_QUEUE)  )
+        return __List__queue_dequeue( p_list );
+    if (  NULL != p_list && NULL != p_list->p_ring  ) {
+        void* p_save = NULL;
+        __List__ring_pop_many( p_list, &p_save, 1 );
+        return p_save;
+    }
+
+    if (  NULL == p_list || NULL == p_list->head  )
+        return NULL;
+
+    if ( p_list->flags & LIST_UNROLLED )
+        return __List__unrolled_remove( p_list, 0 );
+
+    // A shared singly-linked chain is popped by just stepping past its head, which keeps
+    //   the rest of the chain shared.
+    if (  NULL != p_list->p_share && !(p_list->flags & LIST_DOUBLY_LINKED)  ) {
+        void* p_save = p_list->head->data;
+
+        if ( p_list->p_finger == p_list->head )
+            p_list->p_finger = NULL;
+        p_list->finger_index--;
+
+        p_list->head = p_list->head->next;
+        if ( 0 == --(p_list->count) )
+            List__clear_shallow( p_list );
+
+        return p_save;
+    }
+    LIST_UNSHARE( p_list, NULL );
+
+    // Unhook the old head, which sets the HEAD to the next/saved stack item.
+    ListNode_t* p_old_head = __List__unlink_node_after( p_list, NULL, 0 );
+
+    // Save head node information and free the old head.
+    void* p_save = p_old_head->data;
+    LIST_NODE_RELEASE( p_list, p_old_head );
+
+    // Return the saved data pointer from the old head node.
+    return p_save;
+}
+
+
+// Pop a batch of items off the head of a ring into an array. Other lists pop nothing.
+size_t List__pop_many( List_t* p_list, void** pp_data, size_t count ) {
+    if (  NULL == p_list || NULL == p_list->p_ring || NULL == pp_data  )  return 0;
+
+    return __List__ring_pop_many( p_list, pp_data, count );
+}
+
+
+// Push a batch of new HEAD elements onto the linked list, all or nothing.
+int List__push_many( List_t* p_list, void** pp_data, size_t count ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  )
+        return __List__unrolled_insert_many( p_list, pp_data, count, true );
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+    LIST_UNSHARE( p_list, -1 );
+
+    if (
+           NULL == p_list
+        || (NULL == pp_data && 0 != count)
+        || count > (p_list->max_size - p_list->count)
+    )  return -1;
+    if ( 0 == count )  return p_list->count;
+
+    // Built back to front, the chain reads just like the result of pushing one by one.
+    ListNode_t* p_last = NULL;
+    ListNode_t* p_first = __List__chain_build( p_list, pp_data, NULL, count, true, &p_last );
+    if ( NULL == p_first )  return -1;
+
+    __List__chain_link_after( p_list, NULL, 0, p_first, p_last, count );
+
+    return p_list->count;
+}
+
+
+// Push a new HEAD element/node onto the linked list.
+int List__push( List_t* p_list, void* p_data ) {
+    if (  NULL != p_list && (p_list->flags & LIST_CONCURRENT_STACK)  )
+        return __List__stack_push( p_list, p_data );
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  )
+        return __List__unrolled_insert( p_list, p_data, 0 );
+    LIST_REFUSE_CONCURRENT( p_list, -1 );
+    LIST_UNSHARE( p_list, -1 );
+
+    if (
+           NULL == p_list
+        || ((p_list->count + 1) > p_list->max_size)
+    )  return -1;
+
+    // New linked list node.
+    ListNode_t* p_node = LIST_NODE_INITIALIZER( p_list );
+    if ( NULL == p_node )  return -1;
+    p_node->data = p_data;
+
+    // Swap in the new list head.
+    __List__link_node_after( p_list, NULL, p_node, 0 );
+
+    return p_list->count;
+}
+
+
+// Remove the first list item (HEAD) and return its data pointer. Wrapper for 'pop'.
+void* List__remove_first( List_t* p_list ) {
+    return List__pop( p_list );
+}
+
+
+// Remove the final list item (TAIL) and return its data pointer.
+void* List__remove_last( List_t* p_list ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  )
+        return __List__unrolled_remove( p_list, (p_list->count - 1) );
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+    LIST_UNSHARE( p_list, NULL );
+
+    if ( NULL == p_list || NULL == p_list->head )  return NULL;
+
+    // Seek the node just before the tail. Doubly-linked nodes already know it, but a
+    //   singly-linked chain has no way back.
+    ListNode_t* p_before = NULL;
+    if ( p_list->flags & LIST_DOUBLY_LINKED )
+        p_before = LIST_NODE_PREV( p_list->tail );
+    else if ( p_list->head != p_list->tail )
+        p_before = __List__get_node_at( p_list, (p_list->count - 2) );
+
+    //sever list chain before the last node, cutting it out
+    ListNode_t* p_tail = __List__unlink_node_after( p_list, p_before, (p_list->count - 1) );
+
+    // Save the data pointer, free the ListNode_t object, and return the old data pointer.
+    void* p_save = p_tail->data;
+    LIST_NODE_RELEASE( p_list, p_tail );
+
+    return p_save;
+}
+
+
+// Remove the list node at the specified index and return its data pointer.
+void* List__remove_at( List_t* p_list, size_t index ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  )
+        return __List__unrolled_remove( p_list, index );
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+    LIST_UNSHARE( p_list, NULL );
+
+    size_t len = List__length( p_list );
+
+    if (  0 == len || index >= len  )
+        return NULL;
+
+    // Knock out easy cases first as applicable.
+    if ( 0 == index )
+        return List__pop( p_list );
+    else if (  (len - 1) == index  )
+        return List__remove_last( p_list );
+
+    // If the element is in the middle somewhere, pop it out and bridge.
+    ListNode_t* p_before = __List__get_node_at( p_list, (index-1) );
+    if ( NULL == p_before || NULL == p_before->next )
+        return NULL;
+
+    // Remove the node and bridge the gap, saving its data pointer before freeing it.
+    ListNode_t* p_target = __List__unlink_node_after( p_list, p_before, index );
+
+    void* p_save = p_target->data;
+    LIST_NODE_RELEASE( p_list, p_target );
+
+    return p_save;
+}
+
+
+// Remove the first occurrence of the node data pointer.
+void* List__remove_first_occurrence( List_t* p_list, void* p_data ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  ) {
+        size_t index;
+        if (  !__List__unrolled_find( p_list, p_data, false, &index )  )  return NULL;
+        __List__unrolled_remove( p_list, index );
+        return p_data;
+    }
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+    LIST_UNSHARE( p_list, NULL );
+
+    if ( NULL == p_list )  return NULL;
+
+    // Hashed lists find the node without learning its position. That only matters to a
+    //   skip index, which is then left to be rebuilt rather than walking to the node.
+    ListNode_t* p_before = NULL;
+    size_t index = __list_index_unknown;
+    ListNode_t* p_target = __List__get_node_first_occurrence(
+        p_list, p_data, &p_before, (NULL == p_list->p_hash) ? &index : NULL );
+    if ( NULL == p_target )
+        return NULL;
+
+    __List__unlink_node_after( p_list, p_before, index );
+    LIST_NODE_RELEASE( p_list, p_target );
+
+    return p_data;
+}
+
+
+// Remove the final occurrence of the node data pointer.
+void* List__remove_last_occurrence( List_t* p_list, void* p_data ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  ) {
+        size_t index;
+        if (  !__List__unrolled_find( p_list, p_data, true, &index )  )  return NULL;
+        __List__unrolled_remove( p_list, index );
+        return p_data;
+    }
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+    LIST_UNSHARE( p_list, NULL );
+
+    ListNode_t* p_before = NULL;
+    size_t index;
+    ListNode_t* p_target = __List__get_node_last_occurrence( p_list, p_data, &p_before, &index );
+    if ( NULL == p_target )
+        return NULL;
+
+    __List__unlink_node_after( p_list, p_before, index );
+    LIST_NODE_RELEASE( p_list, p_target );
+
+    return p_data;
+}
+
+
+// Set the node data pointer at the selected location and return the old pointer.
+void* List__set_at( List_t* p_list, size_t index, void* p_new_data ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  ) {
+        size_t slot;
+        ListUnrolledNode_t* p_unrolled = __List__unrolled_seek( p_list, index, &slot );
+        if ( NULL == p_unrolled )  return NULL;
+
+        void* p_save = p_unrolled->data[slot];
+        p_unrolled->data[slot] = p_new_data;
+        return p_save;
+    }
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+    LIST_UNSHARE( p_list, NULL );
+
+    ListNode_t* p_node = __List__get_node_at( p_list, index );
+    if ( NULL == p_node )
+        return NULL;
+
+    // Swap data pointer and return the old pointer in case caller wants to free.
+    void* p_save = p_node->data;
+
+    if ( NULL != p_list->p_hash )  __List__hash_remove( p_list, p_node );
+    p_node->data = p_new_data;
+    if ( NULL != p_list->p_hash )  __List__hash_add( p_list, p_node );
+
+    return p_save;
+}
+
+
+// Return the length of a linked list.
+size_t List__length( List_t* p_list ) {
+    if ( NULL == p_list )  return 0;
+
+    // Concurrent lists keep an atomic count instead, which includes in-flight insertions.
+    if ( NULL != p_list->p_concurrent )
+        return atomic_load_explicit( &(p_list->p_concurrent->count), memory_order_relaxed );
+
+    // The head is read first so that a racing producer can only make the count larger.
+    if ( NULL != p_list->p_ring ) {
+        size_t head = atomic_load_explicit( &(p_list->p_ring->head), memory_order_acquire );
+        return atomic_load_explicit( &(p_list->p_ring->tail), memory_order_acquire ) - head;
+    }
+
+    return p_list->count;
+}
+
+
+// Wrapper/Alias function.
+size_t List__count( List_t* p_list ) {
+    return List__length( p_list );
+}
+
+
+// Wrapper/Alias function.
+size_t List__size( List_t* p_list ) {
+    return List__length( p_list );
+}
+
+
+// Copy all linked list elements to a contiguous chunk of memory. NULL on error.
+void* List__to_array( List_t* p_list, size_t element_size, size_t extra_bytes ) {
+    if (  NULL != p_list && (p_list->flags & LIST_UNROLLED)  )
+        return __List__unrolled_to_array( p_list, 0, p_list->count, element_size, extra_bytes );
+    LIST_REFUSE_CONCURRENT( p_list, NULL );
+
+    if ( NULL == p_list )  return NULL;
+
+    return __List__chain_to_array( p_list, p_list->head, p_list->count, element_size, extra_bytes );
+}
+
+
+// Export list elements into a caller's buffer, continuing from the cursor's position.
+size_t List__to_array_into(
+    List_t* p_list,
+    void* p_buffer,
+    size_t buffer_size,
+    size_t element_size,
+    ListCursor_t* p_cursor
+) {
+    LIST_REFUSE_CONCURRENT( p_list, 0 );
+
+    if (
+           NULL == p_list
+        || NULL == p_buffer
+        || 0 == element_size
+        || NULL == p_cursor
+        || p_list != p_cursor->p_list
+    )  return 0;
+
+    char* p_dest_scroll = (char*)p_buffer;
+    size_t fits = buffer_size / element_size;
+    size_t written = 0;
+
+    while (  written < fits && !List__cursor_at_end( p_cursor )  ) {
+        void* p_data = List__cursor_get( p_cursor );
+
+        if ( NULL == p_data )
+            memset( p_dest_scroll, 0, element_size );
+        else
+            memcpy( p_dest_scroll, p_data, element_size );
+
+        List__cursor_next( p_cursor );
+
+        p_dest_scroll += element_size;
+        written++;
+    }
+
+    return written;
+}
+
+
+// Gather the data pointers of a list into a new array.
+void** List__to_ptr_array( List_t* p_list ) {
+    if (  NULL != p_list && (p_list->flags & LIST_CONCURRENT_MODES)  )  return NULL;
+
+    size_t len = List__length( p_list );
+    if (  0 == len || len > (SIZE_MAX / sizeof(void*))  )  return NULL;
+
+    return __List__gather( p_list, 0, len );
+}
+
+
+// Create a new linked list from an array.
+List_t* List__from_array(
+    void* p_array,
+    size_t element_size,
+    size_t count,
+    size_t list_max_size
+) {
+    if (
+           NULL == p_array
+        || element_size <= 0
+        || count <= 0
+        || list_max_size < count
+    )  return NULL;
+
+    // Create the new list, with room for every node.
+    List_t* p_list = List__new( list_max_size );
+    if ( NULL == p_list )  return NULL;
+
+    if ( !__List__pool_reserve( p_list, count ) ) {
+        List__delete_shallow( &p_list );
+        return NULL;
+    }
+
+    // Walk the array. If at any point there's a failure, nuke the allocated nodes
+    //   to prevent memory leaks.
+    for ( size_t walk = 0; walk < count; walk++ ) {
+
+        void* p_new_element = LIST_ALLOC( p_list, element_size );
+        ListNode_t* p_new_node = (NULL == p_new_element) ? NULL : LIST_NODE_INITIALIZER( p_list );
+
+        if ( NULL == p_new_node ) {
+            if ( NULL != p_new_element )  LIST_FREE( p_list, p_new_element );
+            List__delete_deep( &p_list );
+            return NULL;
+        }
+
+        memcpy( p_new_element, (p_array+(walk*element_size)), element_size );
+        p_new_node->data = p_new_element;
+
+        __List__link_node_after( p_list, p_list->tail, p_new_node, p_list->count );
+    }
+
+    // Return the pointer to the new list.
+    return p_list;
+}
+
+
+// Copy an array of data into a linked list whose elements share one owned block.
+List_t* List__from_array_contiguous(
+    void* p_array,
+    size_t element_size,
+    size_t count,
+    size_t list_max_size
+) {
+    if (
+           NULL == p_array
+        || 0 == element_size
+        || 0 == count
+        || list_max_size < count
+        || count > (SIZE_MAX / element_size)
+    )  return NULL;
+
+    List_t* p_list = List__wrap_array( p_array, element_size, count, list_max_size );
+    if ( NULL == p_list )  return NULL;
+
+    p_list->p_block = (char*)LIST_ALLOC( p_list, (count * element_size) );
+    if ( NULL == p_list->p_block ) {
+        List__delete_shallow( &p_list );
+        return NULL;
+    }
+
+    // One copy for the whole array, then the wrapped nodes are moved over onto the block.
+    memcpy( p_list->p_block, p_array, (count * element_size) );
+    p_list->block_size = count * element_size;
+
+    char* p_element = p_list->p_block;
+    for ( ListNode_t* p_node = p_list->head; NULL != p_node; p_node = p_node->next, p_element += element_size )
+        p_node->data = p_element;
+
+    return p_list;
+}
+
+
+// Wrap the elements of an array in a linked list without copying them.
+List_t* List__wrap_array(
+    void* p_array,
+    size_t element_size,
+    size_t count,
+    size_t list_max_size
+) {
+    if (
+           NULL == p_array
+        || 0 == element_size
+        || 0 == count
+        || list_max_size < count
+    )  return NULL;
+
+    List_t* p_list = List__new( list_max_size );
+    if ( NULL == p_list )  return NULL;
+
+    if ( !__List__pool_reserve( p_list, count ) ) {
+        List__delete_shallow( &p_list );
+        return NULL;
+    }
+
+    // The reservation means none of these node allocations can fail.
+    char* p_element = (char*)p_array;
+    for ( size_t walk = 0; walk < count; walk++, p_element += element_size ) {
+        ListNode_t* p_new_node = LIST_NODE_INITIALIZER( p_list );
+        p_new_node->data = p_element;
+
+        __List__link_node_after( p_list, p_list->tail, p_new_node, p_list->count );
+    }
+
+    return p_list;
+}
+
+
+// For-each iterable functionality  [ or at least an attempt at it :') ].
+void List__for_each(
+    List_t* p_list,
+    void**  pp_result,
+    void*   p_input,
+    void    (*action)(void*, void*, void**),
+    void    (*callback)(void*, void**)
+) {
+    LIST_REFUSE_CONCURRENT( p_list, );
+
+    if (
+           NULL == p_list
+        || NULL == p_list->head
+        || NULL == action
+    )  return;
+
+    if ( p_list->flags & LIST_UNROLLED )
+        __List__unrolled_for_each( LIST_UNROLLED_HEAD( p_list ), 0, p_list->count, pp_result, p_input, action );
+    else
+        __List__chain_for_each( p_list->head, p_list->count, pp_result, p_input, action );
+
+    if ( NULL != callback )
+        (*callback)( p_input, pp_result );
+}
+
+
+// Parallel for-each iteration, where every chunk of the list gets a private result.
+void List__for_each_parallel(
+    List_t* p_list,
+    ListThreadPool_t* p_pool,
+    void**  pp_result,
+    void*   p_input,
+    void    (*action)(void*, void*, void**),
+    void    (*combine)(void*, void*, void**),
+    void    (*callback)(void*, void**)
+) {
+    LIST_REFUSE_CONCURRENT( p_list, );
+
+    if (
+           NULL == p_list
+        || NULL == p_list->head
+        || NULL == action
+    )  return;
+
+    // Make a few chunks per thread so a slow chunk doesn't hold the others up.
+    size_t chunks = (NULL == p_pool)
+        ? 1
+        : ((p_pool->nthreads + 1) * __list_for_each_chunks_per_thread);
+    if ( chunks > p_list->count )  chunks = p_list->count;
+
+    ListForEachTask_t single;
+    ListForEachTask_t* p_tasks = &single;
+    if ( chunks > 1 ) {
+        p_tasks = (ListForEachTask_t*)LIST_ALLOC( p_list, chunks * sizeof(ListForEachTask_t) );
+
+        // Without room to track the chunks, fall back to a single one.
+        if ( NULL == p_tasks ) {
+            p_tasks = &single;
+            chunks = 1;
+        }
+    }
+
+    ListNode_t* p_node = p_list->head;
+    ListUnrolledNode_t* p_unrolled = (p_list->flags & LIST_UNROLLED) ? LIST_UNROLLED_HEAD( p_list ) : NULL;
+    size_t slot = 0;
+    for ( size_t x = 0; x < chunks; x++ ) {
+        p_tasks[x].p_first = p_node;
+        p_tasks[x].p_unrolled = p_unrolled;
+        p_tasks[x].slot = slot;
+        p_tasks[x].length = (p_list->count / chunks) + ((x < (p_list->count % chunks)) ? 1 : 0);
+        p_tasks[x].p_result = NULL;
+        p_tasks[x].p_input = p_input;
+        p_tasks[x].action = action;
+
+        if ( NULL != p_unrolled ) {
+            // Skip whole nodes while the chunk covers the rest of them.
+            slot += p_tasks[x].length;
+            while (  NULL != p_unrolled && slot >= p_unrolled->used  ) {
+                slot -= p_unrolled->used;
+                p_unrolled = p_unrolled->next;
+            }
+        } else {
+            for ( size_t y = 0; y < p_tasks[x].length; y++ )
+                p_node = p_node->next;
+        }
+    }
+
+    if ( 1 == chunks || NULL == p_pool )
+        __List__for_each_task( &p_tasks[0] );
+    else
+        __List__thread_pool_run( p_pool, __List__for_each_task, p_tasks, sizeof(ListForEachTask_t), chunks );
+
+    // Fold the private results together in list order.
+    if ( NULL != combine ) {
+        for ( size_t x = 0; x < chunks; x++ )
+            (*combine)( p_tasks[x].p_result, p_input, pp_result );
+    }
+
+    if ( p_tasks != &single )
+        LIST_FREE( p_list, p_tasks );
+
+    if ( NULL != callback )
+        (*callback)( p_input, pp_result );
+}
+
+
+// Start a pool of worker threads.
+ListThreadPool_t* List__thread_pool_new( size_t nthreads ) {
+    ListThreadPool_t* p_pool = (ListThreadPool_t*)calloc( 1, sizeof(ListThreadPool_t) );
+    if ( NULL == p_pool )  return NULL;
+
+    p_pool->p_threads = (pthread_t*)calloc( (0 == nthreads) ? 1 : nthreads, sizeof(pthread_t) );
+    if ( NULL == p_pool->p_threads ) {
+        free( p_pool );
+        return NULL;
+    }
+
+    pthread_mutex_init( &(p_pool->run_lock), NULL );
+    pthread_mutex_init( &(p_pool->lock), NULL );
+    pthread_cond_init( &(p_pool->work_ready), NULL );
+    pthread_cond_init( &(p_pool->work_done), NULL );
+
+    // Count the workers as they start, so a failure only has to stop the ones running.
+    for ( p_pool->nthreads = 0; p_pool->nthreads < nthreads; p_pool->nthreads++ ) {
+        if (  0 != pthread_create( &(p_pool->p_threads[p_pool->nthreads]), NULL, __List__thread_pool_worker, p_pool )  ) {
+            List__thread_pool_delete( &p_pool );
+            return NULL;
+        }
+    }
+
+    return p_pool;
+}
+
+
+// Stop the workers of a pool and release it.
+void List__thread_pool_delete( ListThreadPool_t** pp_pool ) {
+    if ( NULL == pp_pool || NULL == *pp_pool )  return;
+
+    ListThreadPool_t* p_pool = *pp_pool;
+
+    pthread_mutex_lock( &(p_pool->lock) );
+    p_pool->shutdown = true;
+    pthread_cond_broadcast( &(p_pool->work_ready) );
+    pthread_mutex_unlock( &(p_pool->lock) );
+
+    for ( size_t x = 0; x < p_pool->nthreads; x++ )
+        pthread_join( p_pool->p_threads[x], NULL );
+
+    pthread_cond_destroy( &(p_pool->work_done) );
+    pthread_cond_destroy( &(p_pool->work_ready) );
+    pthread_mutex_destroy( &(p_pool->lock) );
+    pthread_mutex_destroy( &(p_pool->run_lock) );
+
+    free( p_pool->p_threads );
+    free( p_pool );
+    *pp_pool = NULL;
+}
+
+
+// Create a cursor on the first element of a list.
+ListCursor_t List__cursor_begin( List_t* p_list ) {
+    // A cursor without a list is permanently at its end and refuses every edit.
+    if (  NULL != p_list && (p_list->flags & LIST_CONCURRENT_MODES)  )
+        p_list = NULL;
+
+    ListCursor_t cursor = {
+        .p_list = p_list,
+        .p_prev = NULL,
+        .p_node = (NULL == p_list) ? NULL : p_list->head,
+        .index  = 0,
+        .slot   = 0
+    };
+
+    return cursor;
+}
+
+
+// Step a cursor forward by one element.
+bool List__cursor_next( ListCursor_t* p_cursor ) {
+    if ( NULL == p_cursor || NULL == p_cursor->p_node )
+        return false;
+
+    if ( p_cursor->p_list->flags & LIST_UNROLLED ) {
+        ListUnrolledNode_t* p_unrolled = (ListUnrolledNode_t*)p_cursor->p_node;
+
+        if ( ++(p_cursor->slot) == p_unrolled->used ) {
+            p_cursor->p_node = (ListNode_t*)p_unrolled->next;
+            p_cursor->slot = 0;
+        }
+        p_cursor->index++;
+
+        return (NULL != p_cursor->p_node);
+    }
+
+    p_cursor->p_prev = p_cursor->p_node;
+    p_cursor->p_node = p_cursor->p_node->next;
+    p_cursor->index++;
+
+    return (NULL != p_cursor->p_node);
+}
+
+
+// Whether a cursor has run off the end of its list.
+bool List__cursor_at_end( const ListCursor_t* p_cursor ) {
+    return (NULL == p_cursor || NULL == p_cursor->p_node);
+}
+
+
+// Get the data pointer under a cursor.
+void* List__cursor_get( const ListCursor_t* p_cursor ) {
+    if ( NULL == p_cursor || NULL == p_cursor->p_node )
+        return NULL;
+
+    if ( p_cursor->p_list->flags & LIST_UNROLLED )
+        return ((ListUnrolledNode_t*)p_cursor->p_node)->data[p_cursor->slot];
+
+    return p_cursor->p_node->data;
+}
+
+
+// Swap the data pointer under a cursor and return the old one.
+void* List__cursor_set( ListCursor_t* p_cursor, void* p_new_data ) {
+    if (  NULL == p_cursor || NULL == p_cursor->p_node || !__List__cursor_unshare( p_cursor )  )
+        return NULL;
+
+    List_t* p_list = p_cursor->p_list;
+
+    if ( p_list->flags & LIST_UNROLLED ) {
+        ListUnrolledNode_t* p_unrolled = (ListUnrolledNode_t*)p_cursor->p_node;
+        void* p_save = p_unrolled->data[p_cursor->slot];
+
+        p_unrolled->data[p_cursor->slot] = p_new_data;
+        return p_save;
+    }
+
+    void* p_save = p_cursor->p_node->data;
+
+    if ( NULL != p_list->p_hash )  __List__hash_remove( p_list, p_cursor->p_node );
+    p_cursor->p_node->data = p_new_data;
+    if ( NULL != p_list->p_hash )  __List__hash_add( p_list, p_cursor->p_node );
+
+    return p_save;
+}
+
+
+// Insert a new element in front of the cursor position.
+int List__cursor_insert_before( ListCursor_t* p_cursor, void* p_data ) {
+    if (  NULL == p_cursor || NULL == p_cursor->p_list || !__List__cursor_unshare( p_cursor )  )  return -1;
+
+    List_t* p_list = p_cursor->p_list;
+    if (  (p_list->count + 1) > p_list->max_size  )  return -1;
+
+    // Inserting can split the cursor's node, so its element is looked up again after.
+    if ( p_list->flags & LIST_UNROLLED ) {
+        if (  -1 == __List__unrolled_insert( p_list, p_data, p_cursor->index )  )  return -1;
+
+        p_cursor->index++;
+        __List__unrolled_cursor_seek( p_cursor );
+
+        return (int)(p_cursor->index - 1);
+    }
+
+    ListNode_t* p_new_node = LIST_NODE_INITIALIZER( p_list );
+    if ( NULL == p_new_node )  return -1;
+    p_new_node->data = p_data;
+
+    // The new node slots in between the cursor's predecessor and the cursor itself.
+    __List__link_node_after( p_list, p_cursor->p_prev, p_new_node, p_cursor->index );
+    p_cursor->p_prev = p_new_node;
+
+    return (int)(p_cursor->index++);
+}
+
+
+// Insert a new element behind the cursor position.
+int List__cursor_insert_after( ListCursor_t* p_cursor, void* p_data ) {
+    if (
+           NULL == p_cursor
+        || NULL == p_cursor->p_list
+        || NULL == p_cursor->p_node
+        || !__List__cursor_unshare( p_cursor )
+    )  return -1;
+
+    List_t* p_list = p_cursor->p_list;
+    if (  (p_list->count + 1) > p_list->max_size  )  return -1;
+
+    if ( p_list->flags & LIST_UNROLLED ) {
+        if (  -1 == __List__unrolled_insert( p_list, p_data, (p_cursor->index + 1) )  )  return -1;
+
+        __List__unrolled_cursor_seek( p_cursor );
+
+        return (int)(p_cursor->index + 1);
+    }
+
+    ListNode_t* p_new_node = LIST_NODE_INITIALIZER( p_list );
+    if ( NULL == p_new_node )  return -1;
+    p_new_node->data = p_data;
+
+    __List__link_node_after( p_list, p_cursor->p_node, p_new_node, (p_cursor->index + 1) );
+
+    return (int)(p_cursor->index + 1);
+}
+
+
+// Remove the element under the cursor, moving the cursor onto the next element.
+void* List__cursor_remove( ListCursor_t* p_cursor ) {
+    if (
+           NULL == p_cursor
+        || NULL == p_cursor->p_list
+        || NULL == p_cursor->p_node
+        || !__List__cursor_unshare( p_cursor )
+    )  return NULL;
+
+    List_t* p_list = p_cursor->p_list;
+
+    // The next element slides into the removed one's index, wherever it ends up stored.
+    if ( p_list->flags & LIST_UNROLLED ) {
+        void* p_save = __List__unrolled_remove( p_list, p_cursor->index );
+        __List__unrolled_cursor_seek( p_cursor );
+
+        return p_save;
+    }
+
+    ListNode_t* p_target = __List__unlink_node_after( p_list, p_cursor->p_prev, p_cursor->index );
+    p_cursor->p_node = (NULL == p_cursor->p_prev) ? p_list->head : p_cursor->p_prev->next;
+
+    void* p_save = p_target->data;
+    LIST_NODE_RELEASE( p_list, p_target );
+
+    return p_save;
+}
+
+
+
+// Get a non-copying view of an inclusive range of a list.
+ListView_t List__slice_view( List_t* p_list, size_t from_index, size_t to_index ) {
+    ListView_t view = { .p_list = NULL, .p_prev = NULL, .p_first = NULL, .from_index = 0, .length = 0, .slot = 0 };
+
+    if (
+           NULL == p_list
+        || (p_list->flags & LIST_CONCURRENT_MODES)
+        || from_index > to_index
+        || to_index >= p_list->count
+    )  return view;
+
+    if ( p_list->flags & LIST_UNROLLED ) {
+        view.p_first = (ListNode_t*)__List__unrolled_seek( p_list, from_index, &(view.slot) );
+    } else {
+        // Finding the predecessor gives the first node too, and lets cursors edit from there.
+        view.p_prev = (0 == from_index)
+            ? NULL
+            : __List__get_node_at( p_list, (from_index - 1) );
+        view.p_first = (NULL == view.p_prev) ? p_list->head : view.p_prev->next;
+    }
+    if ( NULL == view.p_first )  return view;
+
+    view.p_list = p_list;
+    view.from_index = from_index;
+    view.length = (to_index - from_index) + 1;
+
+    return view;
+}
+
+
+// Get the amount of elements in a view.
+size_t List__view_length( const ListView_t* p_view ) {
+    return (NULL == p_view) ? 0 : p_view->length;
+}
+
+
+// Get the data pointer at an index within a view.
+void* List__view_get_at( const ListView_t* p_view, size_t index ) {
+    if ( NULL == p_view || index >= p_view->length )
+        return NULL;
+
+    // Indexed lists seek faster from their skip index than by walking the view, and
+    //   unrolled lists from the last node they found.
+    if (  NULL != p_view->p_list->p_index || (p_view->p_list->flags & LIST_UNROLLED)  )
+        return List__get_at( p_view->p_list, (p_view->from_index + index) );
+
+    ListNode_t* p_node = p_view->p_first;
+    for ( size_t x = 0; x < index; x++ )
+        p_node = p_node->next;
+
+    return p_node->data;
+}
+
+
+// Get a cursor on the first element of a view.
+ListCursor_t List__view_begin( const ListView_t* p_view ) {
+    ListCursor_t cursor = {
+        .p_list = (NULL == p_view) ? NULL : p_view->p_list,
+        .p_prev = (NULL == p_view) ? NULL : p_view->p_prev,
+        .p_node = (NULL == p_view) ? NULL : p_view->p_first,
+        .index  = (NULL == p_view) ? 0 : p_view->from_index,
+        .slot   = (NULL == p_view) ? 0 : p_view->slot
+    };
+
+    return cursor;
+}
+
+
+// Whether a cursor has left the range of a view.
+bool List__view_at_end( const ListView_t* p_view, const ListCursor_t* p_cursor ) {
+    return (
+           NULL == p_view
+        || List__cursor_at_end( p_cursor )
+        || p_cursor->index < p_view->from_index
+        || (p_cursor->index - p_view->from_index) >= p_view->length
+    );
+}
+
+
+// Iterate the elements of a view.
+void List__view_for_each(
+    const ListView_t* p_view,
+    void**  pp_result,
+    void*   p_input,
+    void    (*action)(void*, void*, void**),
+    void    (*callback)(void*, void**)
+) {
+    if (
+           NULL == p_view
+        || 0 == p_view->length
+        || NULL == action
+    )  return;
+
+    if ( p_view->p_list->flags & LIST_UNROLLED )
+        __List__unrolled_for_each( (ListUnrolledNode_t*)p_view->p_first, p_view->slot, p_view->length, pp_result, p_input, action );
+    else
+        __List__chain_for_each( p_view->p_first, p_view->length, pp_result, p_input, action );
+
+    if ( NULL != callback )
+        (*callback)( p_input, pp_result );
+}
+
+
+// Copy the elements of a view into a new array.
+void* List__view_to_array( const ListView_t* p_view, size_t element_size, size_t extra_bytes ) {
+    if ( NULL == p_view || 0 == p_view->length )
+        return NULL;
+
+    if ( p_view->p_list->flags & LIST_UNROLLED )
+        return __List__unrolled_to_array( p_view->p_list, p_view->from_index, p_view->length, element_size, extra_bytes );
+
+    return __List__chain_to_array( p_view->p_list, p_view->p_first, p_view->length, element_size, extra_bytes );
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+// Internal functions.
+
+// Default allocation callback: plain malloc.
+static void* __List__libc_alloc( size_t size, void* p_context ) {
+    return malloc( size );
+}
+
+
+// Default deallocation callback: plain free.
+static void __List__libc_free( void* p_ptr, void* p_context ) {
+    free( p_ptr );
+}
+
+
+// Hand out a zeroed node from the list's node pool. Released nodes are reused first,
+//   followed by unused space in the pool's chunks, and only then is a new chunk allocated.
+static ListNode_t* __List__node_alloc( List_t* p_list ) {
+    ListNodePool_t* p_pool = &(p_list->pool);
+    ListNode_t* p_node = p_pool->free_nodes;
+
+    if ( NULL != p_node ) {
+        p_pool->free_nodes = p_node->next;
+    } else {
+        ListNodeChunk_t* p_chunk = p_pool->current;
+
+        // Move on to the next (already-allocated but unused) chunk when this one is full.
+        if (
+               NULL != p_chunk
+            && p_chunk->used >= p_chunk->capacity
+            && NULL != p_chunk->next
+        )  p_chunk = p_pool->current = p_chunk->next;
+
+        if ( NULL == p_chunk || p_chunk->used >= p_chunk->capacity ) {
+            // Each new chunk doubles the pool's capacity, up to a fixed maximum chunk size.
+            size_t nodes = p_pool->capacity;
+            if ( nodes < __list_pool_chunk_min_nodes )  nodes = __list_pool_chunk_min_nodes;
+            if ( nodes > __list_pool_chunk_max_nodes )  nodes = __list_pool_chunk_max_nodes;
+
+            p_chunk = (ListNodeChunk_t*)LIST_ALLOC( p_list, sizeof(ListNodeChunk_t) + (nodes * p_pool->node_size) );
+            if ( NULL == p_chunk )  return NULL;
+
+            p_chunk->next = NULL;
+            p_chunk->capacity = nodes;
+            p_chunk->used = 0;
+
+            // A full current chunk is always the last in the chain; append after it.
+            if ( NULL == p_pool->current )
+                p_pool->chunks = p_chunk;
+            else
+                p_pool->current->next = p_chunk;
+
+            p_pool->current = p_chunk;
+            p_pool->capacity += nodes;
+        }
+
+        p_node = (ListNode_t*)( (char*)(p_chunk + 1) + (p_chunk->used * p_pool->node_size) );
+        p_chunk->used++;
+    }
+
+    memset( p_node, 0, p_pool->node_size );
+    return p_node;
+}
+
+
+// Return a node to the list's node pool for reuse.
+static void __List__node_free( List_t* p_list, ListNode_t* p_node ) {
+    if ( NULL == p_node )  return;
+
+    p_node->next = p_list->pool.free_nodes;
+    p_list->pool.free_nodes = p_node;
+}
+
+
+// Drop every node in the pool at once while keeping all chunks around for reuse.
+static void __List__pool_reset( List_t* p_list ) {
+    ListNodePool_t* p_pool = &(p_list->pool);
+
+    for ( ListNodeChunk_t* p_chunk = p_pool->chunks; NULL != p_chunk; p_chunk = p_chunk->next )
+        p_chunk->used = 0;
+
+    p_pool->current = p_pool->chunks;
+    p_pool->free_nodes = NULL;
+}
+
+
+// Free every chunk held by the list's node pool. Any nodes still linked become invalid.
+static void __List__pool_release( List_t* p_list ) {
+    ListNodePool_t* p_pool = &(p_list->pool);
+
+    ListNodeChunk_t* p_chunk = p_pool->chunks;
+    while ( NULL != p_chunk ) {
+        ListNodeChunk_t* p_chunk_shadow = p_chunk->next;
+        LIST_FREE( p_list, p_chunk );
+        p_chunk = p_chunk_shadow;
+    }
+
+    p_pool->chunks = NULL;
+    p_pool->current = NULL;
+    p_pool->free_nodes = NULL;
+    p_pool->capacity = 0;
+}
+
+
+// Order node pool chunks by their address in memory, for qsort.
+static int __List__chunk_compare( const void* p_a, const void* p_b ) {
+    const void* p_chunk_a = *(ListNodeChunk_t* const*)p_a;
+    const void* p_chunk_b = *(ListNodeChunk_t* const*)p_b;
+
+    return (p_chunk_a > p_chunk_b) - (p_chunk_a < p_chunk_b);
+}
+
+
+// Find the chunk holding a node by bisecting an array of chunks sorted by address.
+static ListNodeChunk_t* __List__chunk_owner( ListNodeChunk_t** pp_sorted, size_t chunk_count, const void* p_node ) {
+    size_t low = 0, high = chunk_count;
+    while ( (high - low) > 1 ) {
+        size_t mid = low + ((high - low) / 2);
+        if ( (const void*)pp_sorted[mid] <= p_node )  low = mid;
+        else  high = mid;
+    }
+
+    return pp_sorted[low];
+}
+
+
+// Link a node into the chain directly after the given node, or at HEAD if the given
+//   predecessor is NULL. This keeps the list's TAIL, count and finger current, as well
+//   as the skip index of indexed lists when the new node's index is known.
+static void __List__link_node_after( List_t* p_list, ListNode_t* p_prev, ListNode_t* p_node, size_t index ) {
+    if ( NULL == p_prev ) {
+        p_node->next = p_list->head;
+        p_list->head = p_node;
+    } else {
+        p_node->next = p_prev->next;
+        p_prev->next = p_node;
+    }
+
+    if ( p_list->flags & LIST_DOUBLY_LINKED ) {
+        LIST_NODE_PREV( p_node ) = p_prev;
+        if ( NULL != p_node->next )
+            LIST_NODE_PREV( p_node->next ) = p_node;
+    }
+
+    if ( NULL == p_node->next )
+        p_list->tail = p_node;
+
+    p_list->count++;
+
+    // Nodes linked in at or before the finger push it one position further along.
+    if (  NULL != p_list->p_finger && __list_index_unknown == index  )
+        p_list->p_finger = NULL;
+    else if (  NULL != p_list->p_finger && index <= p_list->finger_index  )
+        p_list->finger_index++;
+
+    if ( NULL != p_list->p_index )
+        __List__skip_insert( p_list, p_node, index );
+    if ( NULL != p_list->p_hash )
+        __List__hash_add( p_list, p_node );
+}
+
+
+// Unlink the node directly after the given node (or the HEAD if the predecessor is NULL)
+//   and return it without freeing it. This keeps the list's TAIL, count and finger
+//   current, as well as the skip index of indexed lists when the node's index is known.
+static ListNode_t* __List__unlink_node_after( List_t* p_list, ListNode_t* p_prev, size_t index ) {
+    ListNode_t* p_node = (NULL == p_prev) ? p_list->head : p_prev->next;
+    if ( NULL == p_node )  return NULL;
+
+    if ( NULL == p_prev )
+        p_list->head = p_node->next;
+    else
+        p_prev->next = p_node->next;
+
+    if (  (p_list->flags & LIST_DOUBLY_LINKED) && NULL != p_node->next  )
+        LIST_NODE_PREV( p_node->next ) = p_prev;
+
+    if ( p_list->tail == p_node )
+        p_list->tail = p_prev;
+
+    p_list->count--;
+    p_node->next = NULL;
+
+    // An unlinked finger falls back onto its predecessor, and unlinking a node before the
+    //   finger pulls it one position back.
+    if ( p_list->p_finger == p_node ) {
+        p_list->p_finger = p_prev;
+        p_list->finger_index = index - 1;
+        if ( __list_index_unknown == index || 0 == index )
+            p_list->p_finger = NULL;
+    } else if (  NULL != p_list->p_finger && __list_index_unknown == index  ) {
+        p_list->p_finger = NULL;
+    } else if (  NULL != p_list->p_finger && index < p_list->finger_index  ) {
+        p_list->finger_index--;
+    }
+
+    if ( NULL != p_list->p_index )
+        __List__skip_remove( p_list, p_node, index );
+    if ( NULL != p_list->p_hash )
+        __List__hash_remove( p_list, p_node );
+
+    return p_node;
+}
+
+
+// Make sure the node pool can hand out the given amount of nodes without allocating,
+//   allocating (at most) one chunk big enough for the shortfall if it can't.
+static bool __List__pool_reserve( List_t* p_list, size_t count ) {
+    ListNodePool_t* p_pool = &(p_list->pool);
+    size_t available = 0;
+
+    // Only count as much of the free list as could matter.
+    for ( ListNode_t* p_node = p_pool->free_nodes; NULL != p_node && available < count; p_node = p_node->next )
+        available++;
+
+    if (  available < count && NULL != p_pool->current  ) {
+        available += p_pool->current->capacity - p_pool->current->used;
+        for ( ListNodeChunk_t* p_chunk = p_pool->current->next; NULL != p_chunk && available < count; p_chunk = p_chunk->next )
+            available += p_chunk->capacity;
+    }
+
+    if ( available >= count )  return true;
+
+    // Grow as usual, unless the batch needs more than that in one go.
+    size_t nodes = p_pool->capacity;
+    if ( nodes < __list_pool_chunk_min_nodes )  nodes = __list_pool_chunk_min_nodes;
+    if ( nodes > __list_pool_chunk_max_nodes )  nodes = __list_pool_chunk_max_nodes;
+    if ( nodes < (count - available) )  nodes = count - available;
+
+    ListNodeChunk_t* p_chunk = (ListNodeChunk_t*)LIST_ALLOC( p_list, sizeof(ListNodeChunk_t) + (nodes * p_pool->node_size) );
+    if ( NULL == p_chunk )  return false;
+
+    p_chunk->capacity = nodes;
+    p_chunk->used = 0;
+
+    // Chunks after the current one are unused, so the new one can go right after it.
+    if ( NULL == p_pool->current ) {
+        p_chunk->next = p_pool->chunks;
+        p_pool->chunks = p_pool->current = p_chunk;
+    } else {
+        p_chunk->next = p_pool->current->next;
+        p_pool->current->next = p_chunk;
+    }
+
+    p_pool->capacity += nodes;
+    return true;
+}
+
+
+// Copy the elements of a run of nodes into a new array allocated through the list's
+//   allocator, with some zeroed bytes after them. Fails (NULL) on any NULL element.
+static void* __List__chain_to_array(
+    List_t* p_list,
+    ListNode_t* p_node,
+    size_t count,
+    size_t element_size,
+    size_t extra_bytes
+) {
+    // Calculate the necessary space.
+    size_t dest_size = (count * element_size);
+
+    if ( 0 == dest_size )
+        return NULL;
+
+    // Allocate the array space. Every element gets overwritten, so only the extra bytes
+    //   need to be zeroed.
+    void* const p_dest = LIST_ALLOC( p_list, (dest_size + extra_bytes) );
+    if ( NULL == p_dest )
+        return NULL;
+
+    memset( (char*)p_dest + dest_size, 0, extra_bytes );
+
+    char* p_dest_scroll = p_dest;   //walking/scrolling pointer.
+
+    // Iterate all list data. If a null pointer exists, return error.
+    for ( size_t x = 0; x < count; x++ ) {
+        if ( NULL == p_node->data ) {
+            LIST_FREE( p_list, p_dest );
+            return NULL;
+        }
+
+        memcpy( p_dest_scroll, p_node->data, element_size );
+
+        p_node = p_node->next;
+        p_dest_scroll += element_size;
+    }
+
+    // Return the pointer to the populated array space.
+    return (void*)p_dest;
+}
+
+
+// Run a for-each action over a run of nodes.
+static void __List__chain_for_each(
+    ListNode_t* p_node,
+    size_t count,
+    void** pp_result,
+    void* p_input,
+    void (*action)(void*, void*, void**)
+) {
+    for ( size_t x = 0; x < count; x++ ) {
+        (*action)( p_node->data, p_input, pp_result );
+
+        p_node = p_node->next;
+    }
+}
+
+
+// Create a list which shares a complete node chain (one ending at the source's TAIL)
+//   with the source list. The source's pool is handed over to the share the first time
+//   its nodes are shared.
+static List_t* __List__share_chain( List_t* p_list, ListNode_t* p_first, ListNode_t* p_last, size_t count ) {
+    List_t* p_new = List__new_with_options( p_list->max_size, p_list->flags, &(p_list->allocator) );
+    if ( NULL == p_new )  return NULL;
+
+    if ( NULL == p_list->p_share ) {
+        ListShare_t* p_share = (ListShare_t*)LIST_ALLOC( p_list, sizeof(ListShare_t) );
+        if ( NULL == p_share ) {
+            List__delete_shallow( &p_new );
+            return NULL;
+        }
+
+        atomic_init( &(p_share->refs), 1 );
+        p_share->pool = p_list->pool;
+        p_share->head = p_list->head;
+        p_share->count = p_list->count;
+
+        p_list->pool.chunks = NULL;
+        p_list->pool.current = NULL;
+        p_list->pool.free_nodes = NULL;
+        p_list->pool.capacity = 0;
+        p_list->p_share = p_share;
+    }
+
+    atomic_fetch_add( &(p_list->p_share->refs), 1 );
+    p_new->p_share = p_list->p_share;
+
+    p_new->head = p_first;
+    p_new->tail = p_last;
+    p_new->count = count;
+
+    // The new list's hash is filled in from the shared nodes when it's first needed.
+    if ( NULL != p_new->p_hash )
+        p_new->p_hash->dirty = true;
+
+    return p_new;
+}
+
+
+// Let go of a list's shared nodes without touching them. The caller must unlink them
+//   from the list. The last list to let go releases the shared pool.
+static void __List__share_release( List_t* p_list ) {
+    ListShare_t* p_share = p_list->p_share;
+    if ( NULL == p_share )  return;
+
+    p_list->p_share = NULL;
+    if ( 1 != atomic_fetch_sub( &(p_share->refs), 1 ) )  return;
+
+    ListNodeChunk_t* p_chunk = p_share->pool.chunks;
+    while ( NULL != p_chunk ) {
+        ListNodeChunk_t* p_chunk_shadow = p_chunk->next;
+        LIST_FREE( p_list, p_chunk );
+        p_chunk = p_chunk_shadow;
+    }
+
+    LIST_FREE( p_list, p_share );
+}
+
+
+// Give a list nodes of its own in place of shared ones. The last list holding a share
+//   takes the shared pool back as its own when its chain is still the one first shared;
+//   otherwise the chain is copied with one pool reservation. Returns false, leaving the
+//   list shared, if the copy can't be allocated.
+static bool __List__unshare( List_t* p_list ) {
+    ListShare_t* p_share = p_list->p_share;
+
+    if (
+           1 == atomic_load( &(p_share->refs) )
+        && p_share->head == p_list->head
+        && p_share->count == p_list->count
+        && NULL == p_list->pool.chunks
+    ) {
+        size_t node_size = p_list->pool.node_size;
+        p_list->pool = p_share->pool;
+        p_list->pool.node_size = node_size;
+
+        p_list->p_share = NULL;
+        LIST_FREE( p_list, p_share );
+        return true;
+    }
+
+    size_t count = p_list->count;
+    ListNode_t* p_last = NULL;
+    ListNode_t* p_first = __List__chain_build( p_list, NULL, p_list->head, count, false, &p_last );
+    if (  NULL == p_first && 0 != count  )  return false;
+
+    __List__share_release( p_list );
+
+    p_list->head = NULL;
+    p_list->tail = NULL;
+    p_list->count = 0;
+    p_list->p_finger = NULL;
+
+    // The hash may hold shared nodes; relinking the copy fills it in again.
+    if ( NULL != p_list->p_hash )
+        __List__hash_reset( p_list );
+    if ( NULL != p_first )
+        __List__chain_link_after( p_list, NULL, 0, p_first, p_last, count );
+
+    return true;
+}
+
+
+// Unshare the list of a cursor which is about to change it, moving the cursor onto the
+//   same position in the list's own nodes.
+static bool __List__cursor_unshare( ListCursor_t* p_cursor ) {
+    List_t* p_list = p_cursor->p_list;
+    if ( NULL == p_list->p_share )  return true;
+
+    if (  !__List__unshare( p_list )  )  return false;
+
+    p_cursor->p_prev = (0 == p_cursor->index)
+        ? NULL
+        : __List__get_node_at( p_list, (p_cursor->index - 1) );
+    p_cursor->p_node = (NULL == p_cursor->p_prev) ? p_list->head : p_cursor->p_prev->next;
+
+    return true;
+}
+
+
+// Hand every chunk and free node of one list's pool over to another's. The adopted
+//   chunks go in front of the destination's chain, where the bump allocator never looks,
+//   so partly-used chunks can't be mistaken for unused ones; their spare room is reused
+//   once the pool is reset. If the destination has no chunks yet, it simply continues
+//   from wherever the source's pool was.
+static void __List__pool_adopt( List_t* p_list_dest, List_t* p_list_src ) {
+    ListNodePool_t* p_dest = &(p_list_dest->pool);
+    ListNodePool_t* p_src = &(p_list_src->pool);
+
+    if ( NULL != p_src->chunks ) {
+        if ( NULL == p_dest->chunks ) {
+            p_dest->chunks = p_src->chunks;
+            p_dest->current = p_src->current;
+        } else {
+            ListNodeChunk_t* p_last = p_src->chunks;
+            while ( NULL != p_last->next )  p_last = p_last->next;
+
+            p_last->next = p_dest->chunks;
+            p_dest->chunks = p_src->chunks;
+        }
+    }
+
+    if ( NULL != p_src->free_nodes ) {
+        ListNode_t* p_last = p_src->free_nodes;
+        while ( NULL != p_last->next )  p_last = p_last->next;
+
+        p_last->next = p_dest->free_nodes;
+        p_dest->free_nodes = p_src->free_nodes;
+    }
+
+    p_dest->capacity += p_src->capacity;
+
+    p_src->chunks = NULL;
+    p_src->current = NULL;
+    p_src->free_nodes = NULL;
+    p_src->capacity = 0;
+}
+
+
+// Whether the nodes of one list can be moved into another as they are: both must use
+//   the same node layout and the same allocator, and the source must own its nodes and
+//   must not own a block of elements which would leave along with them.
+static bool __List__can_move_nodes( List_t* p_list_dest, List_t* p_list_src ) {
+    unsigned int layout = (LIST_DOUBLY_LINKED | LIST_INDEXED | LIST_EXCLUSIVE_MODES);
+
+    return (
+           NULL != p_list_dest
+        && NULL != p_list_src
+        && p_list_dest != p_list_src
+        && 0 == ((p_list_dest->flags | p_list_src->flags) & LIST_EXCLUSIVE_MODES)
+        && (p_list_dest->flags & layout) == (p_list_src->flags & layout)
+        && p_list_dest->allocator.alloc == p_list_src->allocator.alloc
+        && p_list_dest->allocator.free == p_list_src->allocator.free
+        && p_list_dest->allocator.p_context == p_list_src->allocator.p_context
+        && NULL == p_list_src->p_block
+        && NULL == p_list_src->p_share
+    );
+}
+
+
+// Move all nodes of one list into another at the given index, along with the node
+//   memory holding them, leaving the source empty.
+static int __List__move_nodes( List_t* p_list_dest, List_t* p_list_src, size_t index ) {
+    size_t src_len = p_list_src->count;
+
+    if (
+           index > p_list_dest->count
+        || src_len > (p_list_dest->max_size - p_list_dest->count)
+    )  return -1;
+
+    if ( 0 == src_len ) {
+        List__clear_shallow( p_list_src );
+        return p_list_dest->count;
+    }
+
+    ListNode_t* p_node_before = (0 == index)
+        ? NULL
+        : __List__get_node_at( p_list_dest, (index - 1) );
+
+    // The source's towers and hash describe the source only.
+    if ( NULL != p_list_src->p_index )
+        __List__skip_drop_towers( p_list_src );
+    if ( NULL != p_list_src->p_hash )
+        __List__hash_reset( p_list_src );
+
+    ListNode_t* p_first = p_list_src->head;
+    ListNode_t* p_last = p_list_src->tail;
+
+    __List__pool_adopt( p_list_dest, p_list_src );
+    __List__chain_link_after( p_list_dest, p_node_before, index, p_first, p_last, src_len );
+
+    p_list_src->head = NULL;
+    p_list_src->tail = NULL;
+    p_list_src->count = 0;
+    p_list_src->p_finger = NULL;
+
+    return p_list_dest->count;
+}
+
+
+// Build a detached chain of new nodes holding either an array's data pointers or, when
+//   the array is NULL, those of the nodes starting at p_src. A reversed chain holds them
+//   back to front. Returns the first node, and the last through pp_last. Nothing is built
+//   (NULL) if the nodes can't all be allocated.
+static ListNode_t* __List__chain_build(
+    List_t* p_list,
+    void** pp_data,
+    ListNode_t* p_src,
+    size_t count,
+    bool reversed,
+    ListNode_t** pp_last
+) {
+    if (  0 == count || !__List__pool_reserve( p_list, count )  )  return NULL;
+
+    bool doubly = (p_list->flags & LIST_DOUBLY_LINKED);
+    ListNode_t* p_first = NULL;
+    ListNode_t* p_last = NULL;
+
+    for ( size_t x = 0; x < count; x++ ) {
+        ListNode_t* p_node = LIST_NODE_INITIALIZER( p_list );   // can't fail after the reservation
+
+        if ( NULL == pp_data ) {
+            p_node->data = p_src->data;
+            p_src = p_src->next;
+        } else {
+            p_node->data = pp_data[x];
+        }
+
+        if ( NULL == p_first ) {
+            p_first = p_last = p_node;
+        } else if ( reversed ) {
+            p_node->next = p_first;
+            if ( doubly )  LIST_NODE_PREV( p_first ) = p_node;
+            p_first = p_node;
+        } else {
+            p_last->next = p_node;
+            if ( doubly )  LIST_NODE_PREV( p_node ) = p_last;
+            p_last = p_node;
+        }
+    }
+
+    *pp_last = p_last;
+    return p_first;
+}
+
+
+// Link a detached chain into a list after the given node (NULL for the HEAD), whose
+//   first node will be at the given index. Plain lists splice the chain in at once;
+//   indexed and hashed lists link each node in turn so their structures stay current.
+static void __List__chain_link_after(
+    List_t* p_list,
+    ListNode_t* p_prev,
+    size_t index,
+    ListNode_t* p_first,
+    ListNode_t* p_last,
+    size_t count
+) {
+    if (  NULL != p_list->p_index || NULL != p_list->p_hash  ) {
+        for ( size_t x = 0; x < count; x++ ) {
+            ListNode_t* p_node = p_first;
+            p_first = p_first->next;
+
+            __List__link_node_after( p_list, p_prev, p_node, (index + x) );
+            p_prev = p_node;
+        }
+        return;
+    }
+
+    ListNode_t* p_after = (NULL == p_prev) ? p_list->head : p_prev->next;
+
+    if ( NULL == p_prev )
+        p_list->head = p_first;
+    else
+        p_prev->next = p_first;
+    p_last->next = p_after;
+
+    if ( p_list->flags & LIST_DOUBLY_LINKED ) {
+        LIST_NODE_PREV( p_first ) = p_prev;
+        if ( NULL != p_after )
+            LIST_NODE_PREV( p_after ) = p_last;
+    }
+
+    if ( NULL == p_after )
+        p_list->tail = p_last;
+
+    p_list->count += count;
+
+    if (  NULL != p_list->p_finger && index <= p_list->finger_index  )
+        p_list->finger_index += count;
+}
+
+
+// Note that nodes were rearranged without tracking their positions. The finger is
+//   dropped, the skip index is rebuilt when next needed, and the pointer hash forgets
+//   which node is the first of each duplicated pointer.
+static void __List__invalidate_positions( List_t* p_list ) {
+    p_list->p_finger = NULL;
+
+    if ( NULL != p_list->p_index )
+        p_list->p_index->dirty = true;
+
+    if (  NULL != p_list->p_hash && NULL != p_list->p_hash->slots  ) {
+        for ( size_t x = 0; x < p_list->p_hash->capacity; x++ )
+            if ( p_list->p_hash->slots[x].count > 1 )
+                p_list->p_hash->slots[x].node = NULL;
+    }
+}
+
+
+// Copy the data pointers of a run of elements of any (non-concurrent) list into a new
+//   array allocated through the list's allocator. NULL if it can't be allocated.
+static void** __List__gather( List_t* p_list, size_t from_index, size_t count ) {
+    void** pp_dest = (void**)LIST_ALLOC( p_list, (count * sizeof(void*)) );
+    if ( NULL == pp_dest )  return NULL;
+
+    void** pp_dest_scroll = pp_dest;
+    if ( p_list->flags & LIST_UNROLLED ) {
+        size_t slot;
+        ListUnrolledNode_t* p_unrolled = __List__unrolled_seek( p_list, from_index, &slot );
+
+        for ( size_t left = count; left > 0; p_unrolled = p_unrolled->next, slot = 0 ) {
+            size_t run = p_unrolled->used - slot;
+            if ( run > left )  run = left;
+
+            memcpy( pp_dest_scroll, &(p_unrolled->data[slot]), (run * sizeof(void*)) );
+            pp_dest_scroll += run;
+            left -= run;
+        }
+
+        return pp_dest;
+    }
+
+    ListNode_t* p_node = __List__get_node_at( p_list, from_index );
+    for ( size_t x = 0; x < count; x++, p_node = p_node->next )
+        *pp_dest_scroll++ = p_node->data;
+
+    return pp_dest;
+}
+
+
+// Copy a run of elements from one list into another at the given index, when either of
+//   them is unrolled. The run's data pointers are gathered into an array before anything
+//   is inserted, so a list can safely take a copy of itself, and a failure leaves the
+//   destination untouched. Returns the destination's new length, or -1 on failure.
+static int __List__insert_list_at(
+    List_t* p_list_dest,
+    size_t index,
+    List_t* p_list_src,
+    size_t from_index,
+    size_t count
+) {
+    if (
+           index > p_list_dest->count
+        || count > (p_list_dest->max_size - p_list_dest->count)
+    )  return -1;
+
+    if ( 0 == count )  return (int)p_list_dest->count;
+
+    void** pp_data = __List__gather( p_list_src, from_index, count );
+    if ( NULL == pp_data )  return -1;
+
+    int result = -1;
+    if ( p_list_dest->flags & LIST_UNROLLED ) {
+        result = __List__unrolled_insert_run( p_list_dest, index, pp_data, count );
+    } else {
+        ListNode_t* p_last = NULL;
+        ListNode_t* p_first = __List__chain_build( p_list_dest, pp_data, NULL, count, false, &p_last );
+
+        if ( NULL != p_first ) {
+            ListNode_t* p_node_before = (0 == index)
+                ? NULL
+                : __List__get_node_at( p_list_dest, (index - 1) );
+            __List__chain_link_after( p_list_dest, p_node_before, index, p_first, p_last, count );
+            result = (int)p_list_dest->count;
+        }
+    }
+
+    LIST_FREE( p_list_src, pp_data );
+    return result;
+}
+
+
+// Sort a NULL-terminated chain of nodes, returning its new first and last nodes.
+static ListNode_t* __List__sort_chain(
+    ListNode_t* p_head,
+    int (*cmp)(const void*, const void*),
+    ListNode_t** pp_tail
+) {
+    // Sort bottom-up like a binary counter: slot 'x' holds a sorted run of 2^x nodes or
+    //   nothing. Each node enters as a run of one and carries merges upward, so runs are
+    //   merged while their nodes are still in cache rather than in full passes over the
+    //   chain. The slot array has a fixed size, no matter how long the chain is.
+    ListNode_t* p_runs[64] = { NULL };
+    size_t filled = 0;
+
+    ListNode_t* p_node = p_head;
+    while ( NULL != p_node ) {
+        ListNode_t* p_carry = p_node;
+        p_node = p_node->next;
+        p_carry->next = NULL;
+
+        // Runs in higher slots hold earlier nodes, so they go on the left to stay stable.
+        size_t x = 0;
+        for ( ; x < filled && NULL != p_runs[x]; x++ ) {
+            __List__merge_runs( p_runs[x], p_carry, cmp, &p_carry );
+            p_runs[x] = NULL;
+        }
+
+        p_runs[x] = p_carry;
+        if ( x == filled )  filled++;
+    }
+
+    // Fold the remaining runs together, from the latest nodes to the earliest.
+    p_head = NULL;
+    *pp_tail = NULL;
+    for ( size_t x = 0; x < filled; x++ ) {
+        if ( NULL != p_runs[x] )
+            *pp_tail = __List__merge_runs( p_runs[x], p_head, cmp, &p_head );
+    }
+
+    return p_head;
+}
+
+
+// Install a sorted chain as the list's nodes, restoring the back-pointers of doubly-linked
+//   lists and invalidating the positional indices.
+static void __List__sort_finish( List_t* p_list, ListNode_t* p_head, ListNode_t* p_tail ) {
+    p_list->head = p_head;
+    p_list->tail = p_tail;
+
+    // Merging only follows 'next', so back-pointers are restored in one final pass.
+    if ( p_list->flags & LIST_DOUBLY_LINKED ) {
+        ListNode_t* p_prev = NULL;
+        for ( ListNode_t* p_node = p_head; NULL != p_node; p_node = p_node->next ) {
+            LIST_NODE_PREV( p_node ) = p_prev;
+            p_prev = p_node;
+        }
+    }
+
+    __List__invalidate_positions( p_list );
+}
+
+
+// Thread entry point which sorts the run of a parallel sort job.
+static void* __List__sort_worker( void* p_job ) {
+    ListSortJob_t* p_sort = (ListSortJob_t*)p_job;
+    p_sort->p_head = __List__sort_chain( p_sort->p_head, p_sort->cmp, &(p_sort->p_tail) );
+
+    return NULL;
+}
+
+
+// Thread entry point which merges the run of a parallel sort job with the run after it.
+static void* __List__merge_worker( void* p_job ) {
+    ListSortJob_t* p_merge = (ListSortJob_t*)p_job;
+    p_merge->p_tail = __List__merge_runs( p_merge->p_head, p_merge->p_right, p_merge->cmp, &(p_merge->p_head) );
+
+    return NULL;
+}
+
+
+// Thread entry point of a pool worker. Workers sleep until a new job is posted, help
+//   finish it, and go back to sleep, until the pool shuts down.
+static void* __List__thread_pool_worker( void* p_arg ) {
+    ListThreadPool_t* p_pool = (ListThreadPool_t*)p_arg;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock( &(p_pool->lock) );
+    for ( ;; ) {
+        while (  !p_pool->shutdown && seen == p_pool->generation  )
+            pthread_cond_wait( &(p_pool->work_ready), &(p_pool->lock) );
+
+        if ( p_pool->shutdown )  break;
+
+        seen = p_pool->generation;
+        __List__thread_pool_drain( p_pool );
+    }
+    pthread_mutex_unlock( &(p_pool->lock) );
+
+    return NULL;
+}
+
+
+// Claim and run tasks of the current job until none are left. The pool lock must be held;
+//   it is released while each task runs.
+static void __List__thread_pool_drain( ListThreadPool_t* p_pool ) {
+    while ( p_pool->next_task < p_pool->task_count ) {
+        void* p_task = p_pool->p_tasks + (p_pool->next_task * p_pool->task_size);
+        void (*run)(void*) = p_pool->run;
+        p_pool->next_task++;
+
+        pthread_mutex_unlock( &(p_pool->lock) );
+        (*run)( p_task );
+        pthread_mutex_lock( &(p_pool->lock) );
+
+        if ( 0 == --(p_pool->pending) )
+            pthread_cond_broadcast( &(p_pool->work_done) );
+    }
+}
+
+
+// Run a job on a worker pool, with the calling thread helping, and wait for it to finish.
+static void __List__thread_pool_run(
+    ListThreadPool_t* p_pool,
+    void (*run)(void*),
+    void* p_tasks,
+    size_t task_size,
+    size_t task_count
+) {
+    pthread_mutex_lock( &(p_pool->run_lock) );
+    pthread_mutex_lock( &(p_pool->lock) );
+
+    p_pool->run = run;
+    p_pool->p_tasks = (char*)p_tasks;
+    p_pool->task_size = task_size;
+    p_pool->task_count = task_count;
+    p_pool->next_task = 0;
+    p_pool->pending = task_count;
+    p_pool->generation++;
+    pthread_cond_broadcast( &(p_pool->work_ready) );
+
+    __List__thread_pool_drain( p_pool );
+    while ( p_pool->pending > 0 )
+        pthread_cond_wait( &(p_pool->work_done), &(p_pool->lock) );
+
+    // Nothing may be claimed from the finished job's task array after this point.
+    p_pool->task_count = 0;
+    p_pool->next_task = 0;
+    p_pool->p_tasks = NULL;
+
+    pthread_mutex_unlock( &(p_pool->lock) );
+    pthread_mutex_unlock( &(p_pool->run_lock) );
+}
+
+
+// Run a parallel for-each action over every node of one chunk.
+static void __List__for_each_task( void* p_task ) {
+    ListForEachTask_t* p_chunk = (ListForEachTask_t*)p_task;
+
+    if ( NULL != p_chunk->p_unrolled ) {
+        __List__unrolled_for_each(
+            p_chunk->p_unrolled, p_chunk->slot, p_chunk->length, &(p_chunk->p_result), p_chunk->p_input, p_chunk->action );
+        return;
+    }
+
+    ListNode_t* p_node = p_chunk->p_first;
+    for ( size_t x = 0; x < p_chunk->length; x++ ) {
+        (*(p_chunk->action))( p_node->data, p_chunk->p_input, &(p_chunk->p_result) );
+        p_node = p_node->next;
+    }
+}
+
+
+// Merge two sorted, NULL-terminated runs into one, hooking it onto the given link. Ties
+//   are taken from the left run to keep the sort stable. Returns the merged run's last node.
+static ListNode_t* __List__merge_runs(
+    ListNode_t* p_left,
+    ListNode_t* p_right,
+    int (*cmp)(const void*, const void*),
+    ListNode_t** pp_link
+) {
+    ListNode_t* p_last = NULL;
+
+    while ( NULL != p_left && NULL != p_right ) {
+        if (  (*cmp)( p_left->data, p_right->data ) <= 0  ) {
+            *pp_link = p_left;
+            p_last = p_left;
+            p_left = p_left->next;
+        } else {
+            *pp_link = p_right;
+            p_last = p_right;
+            p_right = p_right->next;
+        }
+
+        pp_link = &(p_last->next);
+    }
+
+    // Whatever is left of either run is already in order.
+    *pp_link = (NULL != p_left) ? p_left : p_right;
+    while ( NULL != *pp_link ) {
+        p_last = *pp_link;
+        pp_link = &(p_last->next);
+    }
+
+    return p_last;
+}
+
+
+// Fetch the node at the given index, leaving the finger on it. NULL on error condition.
+static ListNode_t* __List__get_node_at( List_t* p_list, size_t index ) {
+    if (
+           NULL == p_list
+        || (index >= p_list->count)
+     )  return NULL;
+
+    ListNode_t* p_node = __List__seek_node( p_list, index );
+
+    p_list->p_finger = p_node;
+    p_list->finger_index = index;
+
+    return p_node;
+}
+
+
+// Find the node at a valid index from whichever known node is nearest.
+static ListNode_t* __List__seek_node( List_t* p_list, size_t index ) {
+    bool doubly = (p_list->flags & LIST_DOUBLY_LINKED);
+
+    // The TAIL is always known, so don't walk the whole chain to find it.
+    if (  (p_list->count - 1) == index  )
+        return p_list->tail;
+
+    ListNode_t* p_node;
+
+    // Lookups near the last one walk from the finger, which makes stepping through the
+    //   list by index linear overall. Walking back from it needs doubly-linked nodes.
+    if ( NULL != p_list->p_finger ) {
+        size_t at = p_list->finger_index;
+        size_t steps = (index >= at) ? (index - at) : (at - index);
+
+        size_t other = (index < (p_list->count - 1 - index)) ? index : (p_list->count - 1 - index);
+        if ( NULL != p_list->p_index )
+            other = __list_finger_reach;
+        else if ( !doubly )
+            other = index;
+
+        if (  (index >= at || doubly) && steps <= other  ) {
+            p_node = p_list->p_finger;
+            for ( ; at < index; at++ )  p_node = p_node->next;
+            for ( ; at > index; at-- )  p_node = LIST_NODE_PREV( p_node );
+
+            return p_node;
+        }
+    }
+
+    // Indexed lists ride the express lanes down to the last node at or before the index,
+    //   leaving only a few steps along the chain itself.
+    if (  NULL != p_list->p_index && (!p_list->p_index->dirty || __List__skip_rebuild( p_list ))  ) {
+        ListNode_t* p_update[LIST_SKIP_MAX_LEVELS];
+        size_t ranks[LIST_SKIP_MAX_LEVELS];
+        __List__skip_find_path( p_list, (index + 2), p_update, ranks );
+
+        size_t position = 0;
+        p_node = p_list->head;
+        if (  p_list->p_index->levels > 0 && NULL != p_update[0]  ) {
+            p_node = p_update[0];
+            position = ranks[0] - 1;
+        }
+
+        for ( ; position < index && NULL != p_node; position++ )
+            p_node = p_node->next;
+
+        return p_node;
+    }
+
+    // Doubly-linked lists can walk back from the TAIL when that end is closer.
+    if (  doubly && index > (p_list->count / 2)  ) {
+        p_node = p_list->tail;
+        for ( size_t i = (p_list->count - 1); i > index && NULL != p_node; i-- )
+            p_node = LIST_NODE_PREV( p_node );
+
+        return p_node;
+    }
+
+    p_node = p_list->head;
+    for ( size_t i = 0; i < index && NULL != p_node; i++ )
+        p_node = p_node->next;
+
+    return p_node;
+}
+
+
+// Fetch the first occurrence of the node with the given data pointer, optionally
+//   returning the node before it and its index through the given pointers.
+//   NULL on error condition or pointer not found.
+static ListNode_t* __List__get_node_first_occurrence(
+    List_t* p_list,
+    void* p_data,
+    ListNode_t** pp_prev,
+    size_t* p_index
+) {
+    if ( NULL == p_list || NULL == p_data )
+        return NULL;
+
+    // Hashed lists know the first occurrence, or at least whether there is one at all.
+    if (  NULL != p_list->p_hash && (!p_list->p_hash->dirty || __List__hash_rebuild( p_list ))  ) {
+        ListHashEntry_t* p_entry = __List__hash_find( p_list, p_data );
+        if ( NULL == p_entry )  return NULL;
+
+        if (  NULL != p_entry->node && NULL == p_index  ) {
+            if ( NULL != pp_prev )  *pp_prev = LIST_NODE_PREV( p_entry->node );
+            return p_entry->node;
+        }
+    }
+
+    ListNode_t* p_node = p_list->head;
+    ListNode_t* p_node_shadow = NULL;
+    size_t index = 0;
+
+    while ( NULL != p_node ) {
+        if ( p_node->data == p_data ) {
+            if ( NULL != pp_prev )  *pp_prev = p_node_shadow;
+            if ( NULL != p_index )  *p_index = index;
+
+            // Remember a first occurrence which had to be looked up again.
+            if (  NULL != p_list->p_hash && !p_list->p_hash->dirty  )
+                __List__hash_find( p_list, p_data )->node = p_node;
+
+            return p_node;
+        }
+
+        p_node_shadow = p_node;
+        p_node = p_node->next;
+        index++;
+    }
+
+    return NULL;
+}
+
+
+// Fetch the last occurrence of the node with the given data pointer, optionally
+//   returning the node before it and its index through the given pointers.
+//   NULL on error condition or pointer not found.
+static ListNode_t* __List__get_node_last_occurrence(
+    List_t* p_list,
+    void* p_data,
+    ListNode_t** pp_prev,
+    size_t* p_index
+) {
+    if ( NULL == p_list || NULL == p_data )
+        return NULL;
+
+    // Hashed lists can turn away pointers which are not in the list at all.
+    if (  NULL != p_list->p_hash && (!p_list->p_hash->dirty || __List__hash_rebuild( p_list ))  ) {
+        if ( NULL == __List__hash_find( p_list, p_data ) )
+            return NULL;
+    }
+
+    // Doubly-linked lists scan backward from the TAIL and stop at the first match.
+    if ( p_list->flags & LIST_DOUBLY_LINKED ) {
+        ListNode_t* p_node = p_list->tail;
+        size_t index = p_list->count;
+
+        while ( NULL != p_node ) {
+            index--;
+
+            if ( p_node->data == p_data ) {
+                if ( NULL != pp_prev )  *pp_prev = LIST_NODE_PREV( p_node );
+                if ( NULL != p_index )  *p_index = index;
+                return p_node;
+            }
+
+            p_node = LIST_NODE_PREV( p_node );
+        }
+
+        return NULL;
+    }
+
+    ListNode_t* p_node = p_list->head;
+    ListNode_t* p_node_before = NULL;
+    ListNode_t* p_found = NULL;
+    size_t index = 0;
 
+    while ( NULL != p_node ) {
+        if ( p_node->data == p_data ) {
+            p_found = p_node;
+            if ( NULL != pp_prev )  *pp_prev = p_node_before;
+            if ( NULL != p_index )  *p_index = index;
+        }
 
+        p_node_before = p_node;
+        p_node = p_node->next;
+        index++;
+    }
 
-// Internal function prototypes as needed.
-static ListNode_t* __List__get_last_node( List_t* p_list );
-static ListNode_t* __List__get_node_at( List_t* p_list, size_t index );
-static ListNode_t* __List__get_node_first_occurrence( List_t* p_list, void* p_data );
-static ListNode_t* __List__get_node_last_occurrence( List_t* p_list, void* p_data );
-static size_t __List__index_of_node( List_t* p_list, ListNode_t* p_node );
+    return p_found;
+}
 
 
 
-// Create a new linked list.
-List_t* List__new( size_t max_size ) {
-    if ( 0 == max_size )
-        max_size = __list_size_max_limit;
+// Draw the height of a new node's tower. Each level is reached with a 1/4 chance, so
+//   most nodes get no tower at all.
+static size_t __List__skip_random_height( List_t* p_list ) {
+    unsigned long long x = p_list->p_index->seed;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    p_list->p_index->seed = x;
 
-    List_t* p_list = (List_t*)calloc( 1, sizeof(List_t) );
-    p_list->head = NULL;
-    p_list->max_size = max_size;
+    size_t height = 0;
+    while ( 0 == (x & 3) && height < LIST_SKIP_MAX_LEVELS ) {
+        height++;
+        x >>= 2;
+    }
 
-    return p_list;
+    return height;
 }
 
 
-// Shallow deletion of list elements and the list allocation itself.
-void List__delete_shallow( List_t** pp_list ) {
-    List__clear_shallow( *pp_list );
+// Allocate a tower with the given amount of lanes, all of them leading nowhere.
+static ListSkipTower_t* __List__skip_tower_alloc( List_t* p_list, size_t height ) {
+    size_t size = sizeof(ListSkipTower_t) + (height * sizeof(ListSkipLane_t));
 
-    free( *pp_list );
-    *pp_list = NULL;
+    ListSkipTower_t* p_tower = (ListSkipTower_t*)LIST_ALLOC( p_list, size );
+    if ( NULL == p_tower )  return NULL;
 
-    return;
+    memset( p_tower, 0, size );
+    p_tower->height = height;
+
+    return p_tower;
 }
 
 
-// Deeply delete all list nodes and the list pointer.
-void List__delete_deep( List_t** pp_list ) {
-    List__clear_deep( *pp_list );
+// Find, for each express lane, the last node whose rank (its index plus one, with the
+//   header at rank 0) is below the given rank. NULL entries refer to the header.
+static void __List__skip_find_path(
+    List_t* p_list,
+    size_t rank,
+    ListNode_t** pp_update,
+    size_t* p_ranks
+) {
+    ListNode_t* p_node = NULL;
+    size_t node_rank = 0;
 
-    free( *pp_list );
-    *pp_list = NULL;
+    for ( size_t level = p_list->p_index->levels; level-- > 0; ) {
+        ListSkipLane_t* p_lane = LIST_SKIP_LANE( p_list, p_node, level );
 
-    return;
+        while (  NULL != p_lane->next && (node_rank + p_lane->span) < rank  ) {
+            node_rank += p_lane->span;
+            p_node = p_lane->next;
+            p_lane = LIST_SKIP_LANE( p_list, p_node, level );
+        }
+
+        pp_update[level] = p_node;
+        p_ranks[level] = node_rank;
+    }
 }
 
 
-// Reverse a linked-list.
-void List__reverse( List_t** pp_list ) {
-    List_t* p_target = *pp_list;
+// Account for a node which was just linked into the chain at the given index.
+static void __List__skip_insert( List_t* p_list, ListNode_t* p_node, size_t index ) {
+    ListSkipIndex_t* p_index = p_list->p_index;
 
-    if (  List__length( p_target ) <= 0  )  return;
+    if ( __list_index_unknown == index )
+        p_index->dirty = true;
+    if ( p_index->dirty )  return;
 
-    // New list structure.
-    List_t* p_new = List__new( p_target->max_size );
+    // A node without a tower on the TAIL lies past the end of every lane: nothing to do.
+    size_t height = __List__skip_random_height( p_list );
+    if (  0 == height && (p_list->count - 1) == index  )  return;
 
-    // Go from 0-LEN on the old list, PUSHing nodes onto the new list.
-    //   0 --> 0, 1 --> 0, 2 --> 0
-    //   Using the underlying stack-like mechanism of the list makes this simple and quick.
-    ListNode_t* p_node = p_target->head;
-    do {
-        List__push( p_new, p_node->data );
-        p_node = p_node->next;
-    } while ( NULL != p_node );
+    ListNode_t* p_update[LIST_SKIP_MAX_LEVELS];
+    size_t ranks[LIST_SKIP_MAX_LEVELS];
+    __List__skip_find_path( p_list, (index + 1), p_update, ranks );
 
-    // Shallow deletion of old structure.
-    List__delete_shallow( pp_list );
+    ListSkipTower_t* p_tower = NULL;
+    if ( height > 0 ) {
+        p_tower = __List__skip_tower_alloc( p_list, height );
 
-    // Set the passed pointer to the new list, effectively modifying it in-place (by ref).
-    *pp_list = p_new;
-    return;
+        // Without a tower the node simply stays on the bottom level.
+        if ( NULL == p_tower )
+            height = 0;
+        else
+            LIST_NODE_TOWER( p_list, p_node ) = p_tower;
+    }
+
+    // New lanes start out empty at the header.
+    for ( ; p_index->levels < height; p_index->levels++ ) {
+        p_update[p_index->levels] = NULL;
+        ranks[p_index->levels] = 0;
+        p_index->head[p_index->levels].next = NULL;
+        p_index->head[p_index->levels].span = 0;
+    }
+
+    for ( size_t level = 0; level < p_index->levels; level++ ) {
+        ListSkipLane_t* p_lane = LIST_SKIP_LANE( p_list, p_update[level], level );
+
+        if ( level < height ) {
+            // Splice the node into this lane. Everything past it moved forward by one.
+            p_tower->lanes[level].next = p_lane->next;
+            p_tower->lanes[level].span = (NULL == p_lane->next)
+                ? 0
+                : (ranks[level] + p_lane->span - index);
+
+            p_lane->next = p_node;
+            p_lane->span = (index + 1) - ranks[level];
+        } else if ( NULL != p_lane->next ) {
+            // The node lands underneath this lane's link, which now spans one more.
+            p_lane->span++;
+        }
+    }
 }
 
 
-// Shrink or grow a list capacity to the given max_size. If the linked list contains more
-//   elements than the new max_size, an error is returned. Otherwise, return the new max.
-size_t List__resize( List_t* p_list, size_t new_max_size ) {
-    if (  new_max_size < List__length( p_list )  )  return 0;
+// Account for a node which was just unlinked from the given index, releasing its tower.
+static void __List__skip_remove( List_t* p_list, ListNode_t* p_node, size_t index ) {
+    ListSkipIndex_t* p_index = p_list->p_index;
+    ListSkipTower_t* p_tower = LIST_NODE_TOWER( p_list, p_node );
+    LIST_NODE_TOWER( p_list, p_node ) = NULL;
 
-    p_list->max_size = (0 == new_max_size)
-        ? __list_size_max_limit
-        : new_max_size;
+    if ( __list_index_unknown == index )
+        p_index->dirty = true;
 
-    return new_max_size;
-}
+    // A TAIL without a tower lies past the end of every lane, just as it does on insertion.
+    if (  !p_index->dirty && (NULL != p_tower || index < p_list->count)  ) {
+        ListNode_t* p_update[LIST_SKIP_MAX_LEVELS];
+        size_t ranks[LIST_SKIP_MAX_LEVELS];
+        __List__skip_find_path( p_list, (index + 1), p_update, ranks );
 
+        for ( size_t level = 0; level < p_index->levels; level++ ) {
+            ListSkipLane_t* p_lane = LIST_SKIP_LANE( p_list, p_update[level], level );
 
-// Wrapper method to get max_size property.
-size_t List__get_max_size( List_t* p_list ) {
-    return (NULL == p_list) ? 0 : p_list->max_size;
+            if ( p_lane->next == p_node ) {
+                p_lane->span += p_tower->lanes[level].span - 1;
+                p_lane->next = p_tower->lanes[level].next;
+            } else if ( NULL != p_lane->next ) {
+                p_lane->span--;
+            }
+        }
+
+        while (  p_index->levels > 0 && NULL == p_index->head[p_index->levels - 1].next  )
+            p_index->levels--;
+    }
+
+    if ( NULL != p_tower )
+        LIST_FREE( p_list, p_tower );
 }
 
 
-// Shallowly delete a linked list structure, but not the underlying resources.
-void List__clear_shallow( List_t* p_list ) {
-    if ( NULL == p_list )  return;
+// Release every tower held by the nodes of an indexed list, leaving an empty index.
+static void __List__skip_drop_towers( List_t* p_list ) {
+    ListSkipIndex_t* p_index = p_list->p_index;
 
-    ListNode_t* p_node = p_list->head;
-    while ( NULL != p_node ) {
-        ListNode_t* p_node_shadow = p_node->next;
-        free( p_node );
-        p_node = p_node_shadow;
+    if ( !p_index->dirty ) {
+        // Every tower is threaded on the lowest lane, so only towered nodes are visited.
+        ListNode_t* p_node = (p_index->levels > 0) ? p_index->head[0].next : NULL;
+        while ( NULL != p_node ) {
+            ListSkipTower_t* p_tower = LIST_NODE_TOWER( p_list, p_node );
+            LIST_NODE_TOWER( p_list, p_node ) = NULL;
+
+            p_node = p_tower->lanes[0].next;
+            LIST_FREE( p_list, p_tower );
+        }
+    } else {
+        for ( ListNode_t* p_node = p_list->head; NULL != p_node; p_node = p_node->next ) {
+            LIST_FREE(  p_list, LIST_NODE_TOWER( p_list, p_node )  );
+            LIST_NODE_TOWER( p_list, p_node ) = NULL;
+        }
     }
 
-    p_list->head = NULL;
+    p_index->levels = 0;
+    p_index->dirty = false;
 }
 
 
-// Deeply free all held list resources.
-void List__clear_deep( List_t* p_list ) {
-    if ( NULL == p_list )  return;
+// Rebuild a stale skip index from the node chain in a single pass. Towers are assigned
+//   deterministically (every fourth node reaches the first lane, every sixteenth the
+//   second, and so on) which yields a perfectly balanced index. Returns false, leaving
+//   the index stale, if a tower could not be allocated.
+static bool __List__skip_rebuild( List_t* p_list ) {
+    ListSkipIndex_t* p_index = p_list->p_index;
+    __List__skip_drop_towers( p_list );
+
+    ListNode_t* p_last[LIST_SKIP_MAX_LEVELS];
+    size_t last_ranks[LIST_SKIP_MAX_LEVELS];
+    size_t rank = 0;
+
+    for ( ListNode_t* p_node = p_list->head; NULL != p_node; p_node = p_node->next ) {
+        rank++;
+
+        size_t height = 0;
+        for ( size_t r = rank; 0 == (r & 3) && height < LIST_SKIP_MAX_LEVELS; r >>= 2 )
+            height++;
+        if ( 0 == height )  continue;
+
+        ListSkipTower_t* p_tower = __List__skip_tower_alloc( p_list, height );
+        if ( NULL == p_tower ) {
+            p_index->dirty = true;
+            __List__skip_drop_towers( p_list );
+            p_index->dirty = true;
+            return false;
+        }
 
-    ListNode_t* p_node = p_list->head;
-    while ( NULL != p_node ) {
-        // This is the only real difference between shallow and deep clears.
-        //   It's OK to free a NULL ptr per the 'free' man-page.
-        free( p_node->data );
+        LIST_NODE_TOWER( p_list, p_node ) = p_tower;
+
+        for ( size_t level = 0; level < height; level++ ) {
+            if ( level >= p_index->levels ) {
+                p_last[level] = NULL;
+                last_ranks[level] = 0;
+            }
+
+            ListSkipLane_t* p_lane = LIST_SKIP_LANE( p_list, p_last[level], level );
+            p_lane->next = p_node;
+            p_lane->span = rank - last_ranks[level];
+
+            p_last[level] = p_node;
+            last_ranks[level] = rank;
+        }
 
-        ListNode_t* p_node_shadow = p_node->next;
-        free( p_node );
-        p_node = p_node_shadow;
+        if ( height > p_index->levels )
+            p_index->levels = height;
     }
 
-    p_list->head = NULL;
+    // Close off the lanes which were not used this time around.
+    for ( size_t level = p_index->levels; level < LIST_SKIP_MAX_LEVELS; level++ )
+        p_index->head[level].next = NULL;
+
+    p_index->dirty = false;
+    return true;
 }
 
 
-// Add an item onto the tail of a linked list.
-int List__add( List_t* p_list, void* p_data ) {
-    size_t list_len = List__length( p_list );
 
-    if (
-           NULL == p_list
-        || ((list_len + 1) > p_list->max_size)
-    )  return -1;
+// Map a pointer key onto its home slot with Fibonacci hashing.
+static size_t __List__hash_slot( const ListHashIndex_t* p_hash, void* p_key ) {
+    unsigned long long hash = (unsigned long long)(uintptr_t)p_key * __list_hash_multiplier;
 
-    // Init the new list node with the referenced data pointer.
-    ListNode_t* p_new_node = LIST_NODE_INITIALIZER;
-    p_new_node->data = p_data;
+    return (size_t)(hash >> p_hash->shift);
+}
 
-    // If the list is empty, just set the head node.
-    if ( NULL == p_list->head ) {
-        p_list->head = p_new_node;
-    } else {
-        // Otherwise, seek the list tail and set the next node.
-        ListNode_t* p_tailnode = __List__get_last_node( p_list );
-        p_tailnode->next = p_new_node;
+
+// Find the slot of a pointer key. NULL when the pointer is not in the list.
+static ListHashEntry_t* __List__hash_find( List_t* p_list, void* p_key ) {
+    ListHashIndex_t* p_hash = p_list->p_hash;
+    if ( NULL == p_hash->slots )  return NULL;
+
+    size_t mask = p_hash->capacity - 1;
+    for ( size_t x = __List__hash_slot( p_hash, p_key ); NULL != p_hash->slots[x].key; x = (x + 1) & mask ) {
+        if ( p_hash->slots[x].key == p_key )
+            return &(p_hash->slots[x]);
     }
 
-    // Return the place of the new node, which is just the original list length +1.
-    return list_len + 1;
+    return NULL;
 }
 
 
-// Add an item to a linked list somewhere in its chain of nodes.
-int List__add_at( List_t* p_list, void* p_data, size_t index ) {
-    size_t list_len = List__length( p_list );
+// Double the slot table (or allocate its first one) and re-home every entry into it.
+static bool __List__hash_grow( List_t* p_list ) {
+    ListHashIndex_t* p_hash = p_list->p_hash;
 
-    if (
-           NULL == p_list
-        || (list_len + 1) > p_list->max_size
-        || index > list_len   // if len == 3, and list has 0,1,2; this is ok
-    )  return -1;
+    size_t capacity = (0 == p_hash->capacity) ? __list_hash_min_slots : (p_hash->capacity * 2);
+    ListHashEntry_t* p_slots = (ListHashEntry_t*)LIST_ALLOC( p_list, capacity * sizeof(ListHashEntry_t) );
+    if ( NULL == p_slots )  return false;
 
-    // If the new location is head, just insert it and be done; no looping.
-    if ( 0 == index ) {
-        List__push( p_list, p_data );
-        return index;
-    } else if ( list_len == index ) {
-        return List__add( p_list, p_data );
-    }
+    memset( p_slots, 0, capacity * sizeof(ListHashEntry_t) );
 
-    // Get the preceding list node.
-    ListNode_t* p_node_before = __List__get_node_at( p_list, (index-1) );
+    ListHashEntry_t* p_old_slots = p_hash->slots;
+    size_t old_capacity = p_hash->capacity;
 
-    // Get the following (next) node after the one being added.
-    ListNode_t* p_node_after = p_node_before->next;
+    unsigned int shift = 64;
+    for ( size_t x = capacity; x > 1; x >>= 1 )
+        shift--;
 
-    // Create the new node.
-    ListNode_t* p_new_node = LIST_NODE_INITIALIZER;
-    p_new_node->data = p_data;
+    p_hash->slots = p_slots;
+    p_hash->capacity = capacity;
+    p_hash->shift = shift;
 
-    // Insert the new node.
-    p_node_before->next = p_new_node;
-    p_new_node->next = p_node_after;
+    for ( size_t x = 0; x < old_capacity; x++ ) {
+        if ( NULL == p_old_slots[x].key )  continue;
 
-    // Return the index to indicate success.
-    return index;
+        size_t y = __List__hash_slot( p_hash, p_old_slots[x].key );
+        while ( NULL != p_slots[y].key )
+            y = (y + 1) & (capacity - 1);
+
+        p_slots[y] = p_old_slots[x];
+    }
+
+    LIST_FREE( p_list, p_old_slots );
+    return true;
 }
 
 
-// Staple the src linked list to the end of the dest linked list.
-int List__extend( List_t* p_list_dest, List_t* p_list_src ) {
-    size_t dest_len = List__length( p_list_dest );
-    size_t src_len = List__length( p_list_src );
+// Account for a node whose data pointer just entered the list.
+static void __List__hash_add( List_t* p_list, ListNode_t* p_node ) {
+    ListHashIndex_t* p_hash = p_list->p_hash;
+    if (  NULL == p_node->data || p_hash->dirty  )  return;
 
-    if (
-           NULL == p_list_dest
-        || ((dest_len + src_len) > p_list_dest->max_size)
-    )  return -1;
+    ListHashEntry_t* p_entry = __List__hash_find( p_list, p_node->data );
+    if ( NULL != p_entry ) {
+        // A duplicate on the TAIL leaves the first occurrence as it was. Anywhere else, it
+        //   might be the new first occurrence, which is then looked up when next needed.
+        p_entry->count++;
+        if ( NULL != p_node->next )
+            p_entry->node = NULL;
+
+        return;
+    }
+
+    // Keep the table at most half full. If it can't grow, give up on it until a rebuild.
+    if (  ((p_hash->used + 1) * 2) > p_hash->capacity && !__List__hash_grow( p_list )  ) {
+        p_hash->dirty = true;
+        return;
+    }
+
+    size_t mask = p_hash->capacity - 1;
+    size_t x = __List__hash_slot( p_hash, p_node->data );
+    while ( NULL != p_hash->slots[x].key )
+        x = (x + 1) & mask;
+
+    p_hash->slots[x].key = p_node->data;
+    p_hash->slots[x].node = p_node;
+    p_hash->slots[x].count = 1;
+    p_hash->used++;
+}
 
-    // Nothing to add.
-    if (  NULL == p_list_src || 0 == src_len  )
-        return dest_len;
 
-    // If the destination list is empty, create a clone of the src list.
-    if ( 0 == dest_len ) {
-        List_t* p_src_clone = List__clone( p_list_src );
-        if ( NULL == p_src_clone )  return -1;
+// Account for a node whose data pointer just left the list.
+static void __List__hash_remove( List_t* p_list, ListNode_t* p_node ) {
+    ListHashIndex_t* p_hash = p_list->p_hash;
+    if (  NULL == p_node->data || p_hash->dirty  )  return;
 
-        // Set the head (index 0) of dest to the first lnode in the clone.
-        p_list_dest->head = p_src_clone->head;
+    ListHashEntry_t* p_entry = __List__hash_find( p_list, p_node->data );
+    if ( NULL == p_entry )  return;
 
-        // Free the clone's List_t pointer; it's not necessary and will leak.
-        free( p_src_clone );
+    if ( --(p_entry->count) > 0 ) {
+        if ( p_entry->node == p_node )
+            p_entry->node = NULL;
 
-        return List__length( p_list_dest );
+        return;
     }
 
-    // Get destination list tail.
-    ListNode_t* p_src_scroll = p_list_src->head;
-    ListNode_t* p_tail = __List__get_last_node( p_list_dest );
+    // Empty the slot, then shift back any later entries in the probe run which could
+    //   no longer be reached past the hole.
+    size_t mask = p_hash->capacity - 1;
+    size_t hole = (size_t)(p_entry - p_hash->slots);
+    p_entry->key = NULL;
 
-    // If the dest list is empty, enter the first node from src (since we know len > 0)
-    //   and increment by 1.
-    if ( NULL == p_tail ) {
-        if (  -1 == List__push( p_list_dest, p_src_scroll->data )  )
-            return -1;
+    for ( size_t x = (hole + 1) & mask; NULL != p_hash->slots[x].key; x = (x + 1) & mask ) {
+        size_t home = __List__hash_slot( p_hash, p_hash->slots[x].key );
+
+        bool stays = (hole <= x)
+            ? (hole < home && home <= x)
+            : (hole < home || home <= x);
+        if ( stays )  continue;
 
-        p_src_scroll = p_src_scroll->next;
-        p_tail = p_list_dest->head;
+        p_hash->slots[hole] = p_hash->slots[x];
+        p_hash->slots[x].key = NULL;
+        hole = x;
     }
 
-    // Append elements.
-    while ( NULL != p_src_scroll ) {
-        // Add the data pointer to the list, checking for failures.
-        if (  -1 == List__add( p_list_dest, p_src_scroll->data )  ) {
-            // On failure, spawn a tmp linked list pointing to the first NEW node on the list,
-            //   and do a shallow deletion, freeing the newly-allocated node chain.
-            List_t* p_tmp = List__new( 0 );
-            p_tmp->head = p_tail->next;
+    p_hash->used--;
+}
 
-            List__delete_shallow( &p_tmp );
 
-            // Sever the node chain at the original list tail node (as it was).
-            p_tail->next = NULL;
-            return -1;
+// Empty the pointer hash, keeping its slot table for reuse.
+static void __List__hash_reset( List_t* p_list ) {
+    ListHashIndex_t* p_hash = p_list->p_hash;
+
+    if ( NULL != p_hash->slots )
+        memset( p_hash->slots, 0, p_hash->capacity * sizeof(ListHashEntry_t) );
+
+    p_hash->used = 0;
+    p_hash->dirty = false;
+}
+
+
+// Rebuild a stale pointer hash from the node chain in a single pass. Returns false,
+//   leaving the hash stale, if the table could not be grown.
+static bool __List__hash_rebuild( List_t* p_list ) {
+    __List__hash_reset( p_list );
+
+    // Walking in chain order, the first node seen for each pointer is its first occurrence.
+    for ( ListNode_t* p_node = p_list->head; NULL != p_node; p_node = p_node->next ) {
+        ListHashEntry_t* p_entry = __List__hash_find( p_list, p_node->data );
+        if (  NULL != p_entry && NULL != p_node->data  ) {
+            p_entry->count++;
+            continue;
         }
 
-        // Advance to the next item in the source list.
-        p_src_scroll = p_src_scroll->next;
+        __List__hash_add( p_list, p_node );
+        if ( p_list->p_hash->dirty )  return false;
     }
 
-    // Return new destination linked list length.
-    return List__length( p_list_dest );
+    return true;
 }
 
 
-// Extend the destination list and shallowly free the source.
-int List__merge( List_t* p_list_dest, List_t* p_list_src ) {
-    int ext_res = List__extend( p_list_dest, p_list_src );
 
-    if ( -1 != ext_res )
-        List__clear_shallow( p_list_src );
+// Extract the node pointer from a tagged word.
+static void* __List__tagged_ptr( uint64_t word ) {
+    return (void*)(uintptr_t)( word & ((1ULL << __list_tag_shift) - 1) );
+}
 
-    return ext_res;
+
+// Build the tagged word which replaces the given one, pointing at a new node with the
+//   next generation tag.
+static uint64_t __List__tagged_swap( uint64_t word, void* p_ptr ) {
+    uint64_t tag = (word >> __list_tag_shift) + 1;
+
+    return (tag << __list_tag_shift) | (uint64_t)(uintptr_t)p_ptr;
 }
 
 
-// Insert the src linked list into the dest linked list at the index.
-int List__extend_at( List_t* p_list_dest, List_t* p_list_src, size_t index ) {
-    size_t dest_len = List__length( p_list_dest );
-    size_t src_len = List__length( p_list_src );
+// Push a node onto a lock-free (Treiber) stack.
+static void __List__stack_push_node( _Atomic uint64_t* p_top, ListNode_t* p_node ) {
+    uint64_t top = atomic_load_explicit( p_top, memory_order_relaxed );
 
-    if (
-           NULL == p_list_dest
-        || (dest_len + src_len) > p_list_dest->max_size
-        || index > dest_len   // can be the new tail index, so 3 from 0,1,2 (len3)
-    )  return -1;
+    do {
+        atomic_store_explicit( LIST_NODE_NEXT_ATOMIC( p_node ), __List__tagged_ptr( top ), memory_order_relaxed );
+    } while (  !atomic_compare_exchange_weak_explicit(
+                   p_top, &top, __List__tagged_swap( top, p_node ),
+                   memory_order_release, memory_order_relaxed )  );
+}
 
-    // Nothing to add.
-    if (  NULL == p_list_src || 0 == src_len  )
-        return dest_len;
 
-    // Knock out preliminary situations that are simple to handle.
-    if (  (dest_len - 1) == index || 0 == dest_len  )
-        return List__extend( p_list_dest, p_list_src );
+// Pop a node off of a lock-free (Treiber) stack. NULL if the stack is empty. The node read
+//   while racing may already belong to another thread, but nodes are never freed while the
+//   list lives, and the generation tag makes the swap fail if the top changed meanwhile.
+static ListNode_t* __List__stack_pop_node( _Atomic uint64_t* p_top ) {
+    uint64_t top = atomic_load_explicit( p_top, memory_order_acquire );
 
-    // If inserting at position 0 of the destination, simply join the tail of a src clone
-    //   to the head of dest.
-    if ( 0 == index ) {
-        List_t* p_src_clone = List__clone( p_list_src );
-        if ( NULL == p_src_clone )  return -1;
+    for ( ;; ) {
+        ListNode_t* p_node = __List__tagged_ptr( top );
+        if ( NULL == p_node )  return NULL;
+
+        ListNode_t* p_next = atomic_load_explicit( LIST_NODE_NEXT_ATOMIC( p_node ), memory_order_relaxed );
+        if (  atomic_compare_exchange_weak_explicit(
+                  p_top, &top, __List__tagged_swap( top, p_next ),
+                  memory_order_acq_rel, memory_order_acquire )  )
+            return p_node;
+    }
+}
 
-        ListNode_t* p_src_tail = __List__get_last_node( p_src_clone );
 
-        p_src_tail->next = p_list_dest->head;
-        p_list_dest->head = p_src_clone->head;
+// Reserve a place for one more element of a concurrent list under its maximum size. The
+//   count only grows through a successful exchange from below the maximum, so readers
+//   never see it past the limit. Returns the new count, or 0 if the list is full.
+static size_t __List__concurrent_reserve( ListConcurrent_t* p_concurrent ) {
+    size_t count = atomic_load_explicit( &(p_concurrent->count), memory_order_relaxed );
 
-        // Free the clone's List_t but (obv) keep its nodes around.
-        free( p_src_clone );
+    for ( ;; ) {
+        if (  count >= atomic_load_explicit( &(p_concurrent->max_size), memory_order_relaxed )  )
+            return 0;
 
-        return List__length( p_list_dest );
+        if (  atomic_compare_exchange_weak_explicit(
+                  &(p_concurrent->count), &count, (count + 1),
+                  memory_order_relaxed, memory_order_relaxed )  )
+            return (count + 1);
     }
+}
 
-    // Save some markers.
-    ListNode_t* p_scroll = p_list_src->head;
-    ListNode_t* p_node_before = __List__get_node_at( p_list_dest, (index-1) );
-    ListNode_t* p_node_after = __List__get_node_at( p_list_dest, index );
 
-    while ( NULL != p_scroll ) {
-        // Create and add the new node.
-        ListNode_t* p_new_node = LIST_NODE_INITIALIZER;
-        p_new_node->data = p_scroll->data;
+// Push an element onto a concurrent stack. Returns the element count after the push.
+static int __List__stack_push( List_t* p_list, void* p_data ) {
+    ListConcurrent_t* p_concurrent = p_list->p_concurrent;
 
-        // If the list being copied is about to end (tail), restore the save point as the 'next' ptr.
-        //   This should re-establish the linked list chain properly.
-        p_new_node->next = (NULL == p_scroll->next) ? p_node_after : NULL;
+    // Reserve a place under the maximum size before doing anything else.
+    size_t count = __List__concurrent_reserve( p_concurrent );
+    if ( 0 == count )  return -1;
 
-        p_node_before->next = p_new_node;
+    // Recycled nodes are used first; only a fresh node needs the (locked) node pool.
+    ListNode_t* p_node = __List__stack_pop_node( &(p_concurrent->free_top) );
+    if ( NULL == p_node ) {
+        pthread_mutex_lock( &(p_concurrent->grow_lock) );
+        p_node = LIST_NODE_INITIALIZER( p_list );
+        pthread_mutex_unlock( &(p_concurrent->grow_lock) );
 
-        p_node_before = p_node_before->next;   //this is always following prev node
-        p_scroll = p_scroll->next;
+        if ( NULL == p_node ) {
+            atomic_fetch_sub_explicit( &(p_concurrent->count), 1, memory_order_relaxed );
+            return -1;
+        }
     }
 
-    // Return new destination linked list length.
-    return List__length( p_list_dest );
+    p_node->data = p_data;
+    __List__stack_push_node( &(p_concurrent->top), p_node );
+
+    return (int)count;
 }
 
 
-// Extend the destination list at the chosen index and shallowly free the source.
-int List__merge_at( List_t* p_list_dest, List_t* p_list_src, size_t index ) {
-    int ext_res = List__extend_at( p_list_dest, p_list_src, index );
+// Pop an element off of a concurrent stack. NULL if it is empty.
+static void* __List__stack_pop( List_t* p_list ) {
+    ListConcurrent_t* p_concurrent = p_list->p_concurrent;
 
-    if ( -1 != ext_res )
-        List__clear_shallow( p_list_src );
+    ListNode_t* p_node = __List__stack_pop_node( &(p_concurrent->top) );
+    if ( NULL == p_node )  return NULL;
 
-    return ext_res;
+    // The node belongs to this thread now, so its data can be read before recycling it.
+    void* p_save = p_node->data;
+    atomic_fetch_sub_explicit( &(p_concurrent->count), 1, memory_order_relaxed );
+    __List__stack_push_node( &(p_concurrent->free_top), p_node );
+
+    return p_save;
 }
 
 
-// Shallow clone of a linked list's structure. This does not copy underlying data.
-List_t* List__clone( List_t* p_list ) {
-    size_t len = List__length( p_list );
-    if ( NULL == p_list || 0 == len )  return NULL;
+// Get a node for a concurrent queue, recycled if possible. NULL if allocation fails.
+static ListQueueNode_t* __List__queue_node_alloc( List_t* p_list ) {
+    ListConcurrent_t* p_concurrent = p_list->p_concurrent;
+    uint64_t top = atomic_load_explicit( &(p_concurrent->free_top), memory_order_acquire );
 
-    List_t* p_new = List__new( p_list->max_size );
+    for ( ;; ) {
+        ListQueueNode_t* p_node = __List__tagged_ptr( top );
+        if ( NULL == p_node )  break;
 
-    p_new->head = LIST_NODE_INITIALIZER;
-    p_new->head->data = p_list->head->data;
+        ListQueueNode_t* p_next = __List__tagged_ptr( atomic_load_explicit( &(p_node->next), memory_order_relaxed ) );
+        if (  atomic_compare_exchange_weak_explicit(
+                  &(p_concurrent->free_top), &top, __List__tagged_swap( top, p_next ),
+                  memory_order_acq_rel, memory_order_acquire )  )
+            return p_node;
+    }
 
-    ListNode_t* p_scroll = p_new->head;
+    pthread_mutex_lock( &(p_concurrent->grow_lock) );
+    ListQueueNode_t* p_node = (ListQueueNode_t*)LIST_NODE_INITIALIZER( p_list );
+    pthread_mutex_unlock( &(p_concurrent->grow_lock) );
 
-    // Construct blank list nodes to start.
-    for ( size_t x = 1; x < len; x++ ) {
-        ListNode_t* p_new_node = LIST_NODE_INITIALIZER;
+    return p_node;
+}
 
-        p_scroll->next = p_new_node;
-        p_scroll = p_new_node;
-    }
 
-    // Loop again and fill out the data.
-    p_scroll = p_new->head->next;
-    ListNode_t* p_src_scroll = p_list->head->next;
+// Put a node which no longer belongs to a concurrent queue onto its free list. Each write
+//   to the node's link bumps its tag, so that a thread still holding the node's old link
+//   can never swap it.
+static void __List__queue_node_free( List_t* p_list, ListQueueNode_t* p_node ) {
+    ListConcurrent_t* p_concurrent = p_list->p_concurrent;
+    uint64_t top = atomic_load_explicit( &(p_concurrent->free_top), memory_order_relaxed );
 
-    for ( size_t x = 1; x < len; x++ ) {
-        p_scroll->data = p_src_scroll->data;
+    do {
+        uint64_t next = atomic_load_explicit( &(p_node->next), memory_order_relaxed );
+        atomic_store_explicit( &(p_node->next), __List__tagged_swap( next, __List__tagged_ptr( top ) ), memory_order_relaxed );
+    } while (  !atomic_compare_exchange_weak_explicit(
+                   &(p_concurrent->free_top), &top, __List__tagged_swap( top, p_node ),
+                   memory_order_release, memory_order_relaxed )  );
+}
 
-        p_scroll = p_scroll->next;
-        p_src_scroll = p_src_scroll->next;
-    }
 
-    // Return the new List_t shallow clone.
-    return p_new;
-}
+// Append an element to a concurrent queue. Returns the element count after the append.
+static int __List__queue_enqueue( List_t* p_list, void* p_data ) {
+    ListConcurrent_t* p_concurrent = p_list->p_concurrent;
 
+    size_t count = __List__concurrent_reserve( p_concurrent );
+    if ( 0 == count )  return -1;
 
-// Slice a given linked list according to two indices.
-List_t* List__slice( List_t* p_list, size_t from_index, size_t to_index ) {
-    if ( from_index >= to_index || NULL == p_list )  return NULL;
+    ListQueueNode_t* p_node = __List__queue_node_alloc( p_list );
+    if ( NULL == p_node ) {
+        atomic_fetch_sub_explicit( &(p_concurrent->count), 1, memory_order_relaxed );
+        return -1;
+    }
 
-    ListNode_t* p_start = __List__get_node_at( p_list, from_index );
-    ListNode_t* p_end   = __List__get_node_at( p_list, to_index );
-    if ( NULL == p_start || NULL == p_end )  return NULL;
+    atomic_store_explicit( &(p_node->data), p_data, memory_order_relaxed );
+    uint64_t next = atomic_load_explicit( &(p_node->next), memory_order_relaxed );
+    atomic_store_explicit( &(p_node->next), __List__tagged_swap( next, NULL ), memory_order_relaxed );
 
-    List_t* p_new = List__new( p_list->max_size );
+    // Link the node after the last one, helping a lagging TAIL along when it isn't last.
+    uint64_t tail;
+    for ( ;; ) {
+        tail = atomic_load_explicit( &(p_concurrent->tail), memory_order_acquire );
+        ListQueueNode_t* p_tail = __List__tagged_ptr( tail );
+        next = atomic_load_explicit( &(p_tail->next), memory_order_acquire );
 
-    // From start to end of the slice, build up the new list sequentially.
-    while ( p_start != p_end->next ) {
-        if (  -1 == List__add( p_new, p_start->data )  ) {
-            List__delete_shallow( &p_new );
-            return NULL;
-        }
+        if ( tail != atomic_load_explicit( &(p_concurrent->tail), memory_order_acquire ) )
+            continue;
 
-        p_start = p_start->next;
+        if ( NULL == __List__tagged_ptr( next ) ) {
+            if (  atomic_compare_exchange_weak_explicit(
+                      &(p_tail->next), &next, __List__tagged_swap( next, p_node ),
+                      memory_order_release, memory_order_relaxed )  )
+                break;
+        } else {
+            atomic_compare_exchange_strong_explicit(
+                &(p_concurrent->tail), &tail, __List__tagged_swap( tail, __List__tagged_ptr( next ) ),
+                memory_order_release, memory_order_relaxed );
+        }
     }
 
-    return p_new;
+    // Swing the TAIL to the new node; if this fails, another thread already did.
+    atomic_compare_exchange_strong_explicit(
+        &(p_concurrent->tail), &tail, __List__tagged_swap( tail, p_node ),
+        memory_order_release, memory_order_relaxed );
+
+    return (int)count;
 }
 
 
-// Deep copy of a linked list. This creates a fully-independent copy of the provided list.
-List_t* List__copy( List_t* p_list, size_t element_size ) {
-    size_t len = List__length( p_list );
+// Take the first element off of a concurrent queue. NULL if it is empty. The first real
+//   node becomes the new dummy, and the old dummy is recycled.
+static void* __List__queue_dequeue( List_t* p_list ) {
+    ListConcurrent_t* p_concurrent = p_list->p_concurrent;
 
-    if (
-           NULL == p_list
-        || 0 == len
-        || element_size <= 0
-    )  return NULL;
+    for ( ;; ) {
+        uint64_t head = atomic_load_explicit( &(p_concurrent->top), memory_order_acquire );
+        uint64_t tail = atomic_load_explicit( &(p_concurrent->tail), memory_order_acquire );
+        ListQueueNode_t* p_head = __List__tagged_ptr( head );
+        uint64_t next = atomic_load_explicit( &(p_head->next), memory_order_acquire );
 
-    List_t* p_new = List__new( p_list->max_size );
-    p_new->head = LIST_NODE_INITIALIZER;
+        if ( head != atomic_load_explicit( &(p_concurrent->top), memory_order_acquire ) )
+            continue;
 
-    ListNode_t* p_dest_scroll = p_new->head;
-    ListNode_t* p_scroll = p_list->head;
-    ListNode_t* p_tmp = NULL;
-    ListNode_t* p_dest_prev = NULL;
+        ListQueueNode_t* p_next = __List__tagged_ptr( next );
+        if ( __List__tagged_ptr( tail ) == p_head ) {
+            if ( NULL == p_next )  return NULL;
 
-    while ( NULL != p_scroll ) {
-        // Allocate a copy of the scroll node's data.
-        void* p_new_data = calloc( 1, element_size );
+            // The TAIL lags behind an append in flight; help it along.
+            atomic_compare_exchange_strong_explicit(
+                &(p_concurrent->tail), &tail, __List__tagged_swap( tail, p_next ),
+                memory_order_release, memory_order_relaxed );
+            continue;
+        }
 
-        // Set the new data.
-        memcpy( p_new_data, p_scroll->data, element_size );
-        p_dest_scroll->data = p_new_data;
+        // Read the data before the swap, since the node may be dequeued and recycled by
+        //   another thread right after it.
+        void* p_save = atomic_load_explicit( &(p_next->data), memory_order_relaxed );
+        if (  atomic_compare_exchange_weak_explicit(
+                  &(p_concurrent->top), &head, __List__tagged_swap( head, p_next ),
+                  memory_order_acq_rel, memory_order_relaxed )  ) {
+            atomic_fetch_sub_explicit( &(p_concurrent->count), 1, memory_order_relaxed );
+            __List__queue_node_free( p_list, p_head );
+            return p_save;
+        }
+    }
+}
 
-        p_tmp = LIST_NODE_INITIALIZER;
-        p_dest_scroll->next = p_tmp;
 
-        p_dest_prev = p_dest_scroll;
-        p_dest_scroll = p_tmp;
+// Empty a concurrent list whose nodes are being dropped along with the node pool, giving a
+//   queue a fresh dummy node. No other thread may be using the list. False if the dummy
+//   node can't be allocated.
+static bool __List__concurrent_reset( List_t* p_list ) {
+    ListConcurrent_t* p_concurrent = p_list->p_concurrent;
 
-        p_scroll = p_scroll->next;
-    }
+    atomic_store( &(p_concurrent->top), 0 );
+    atomic_store( &(p_concurrent->tail), 0 );
+    atomic_store( &(p_concurrent->free_top), 0 );
+    atomic_store( &(p_concurrent->count), 0 );
 
-    free( p_tmp );
-    p_dest_prev->next = NULL;
+    if ( p_list->flags & LIST_CONCURRENT_QUEUE ) {
+        ListQueueNode_t* p_dummy = (ListQueueNode_t*)LIST_NODE_INITIALIZER( p_list );
+        if ( NULL == p_dummy )  return false;
 
-    return p_new;
+        atomic_store( &(p_concurrent->top), __List__tagged_swap( 0, p_dummy ) );
+        atomic_store( &(p_concurrent->tail), __List__tagged_swap( 0, p_dummy ) );
+    }
+
+    return true;
 }
 
 
-// Gets whether the data pointer exists somewhere within the linked list.
-bool List__contains( List_t* p_list, void* p_data ) {
-    ListNode_t* p_occ = __List__get_node_first_occurrence( p_list, p_data );
 
-    return (NULL != p_occ);
-}
+// Append a batch to a ring, all or nothing. Only the producer thread may call this.
+//   Returns the element count as last seen by the producer.
+static int __List__ring_add_many( List_t* p_list, void** pp_data, size_t count ) {
+    ListRing_t* p_ring = p_list->p_ring;
+    size_t tail = atomic_load_explicit( &(p_ring->tail), memory_order_relaxed );
+    size_t max_size = atomic_load_explicit( &(p_ring->max_size), memory_order_relaxed );
+    if ( 0 == count )  return (int)(tail - p_ring->cached_head);
+
+    // Only look at the consumer's index when the cached one says there's no room.
+    if ( count > (max_size - (tail - p_ring->cached_head)) ) {
+        p_ring->cached_head = atomic_load_explicit( &(p_ring->head), memory_order_acquire );
+        if ( count > (max_size - (tail - p_ring->cached_head)) )
+            return -1;
+    }
+
+    // Copy in up to two runs, around the end of the slots.
+    size_t first = tail & p_ring->mask;
+    size_t run = (p_ring->mask + 1) - first;
+    if ( run > count )  run = count;
+
+    memcpy( &(p_ring->slots[first]), pp_data, (run * sizeof(void*)) );
+    memcpy( &(p_ring->slots[0]), (pp_data + run), ((count - run) * sizeof(void*)) );
 
+    atomic_store_explicit( &(p_ring->tail), (tail + count), memory_order_release );
 
-// Returns 0 if list has content; 1 if no elements.
-bool List__is_empty( List_t* p_list ) {
-    return (NULL != p_list && NULL != p_list->head);
+    return (int)((tail + count) - p_ring->cached_head);
 }
 
 
-// Gets the first data element (HEAD) of the linked list.
-void* List__get_first( List_t* p_list ) {
-    if ( NULL == p_list || NULL == p_list->head )  return NULL;
+// Take up to the given amount of elements off of a ring. Only the consumer thread may call
+//   this. Returns the amount taken.
+static size_t __List__ring_pop_many( List_t* p_list, void** pp_data, size_t count ) {
+    ListRing_t* p_ring = p_list->p_ring;
+    size_t head = atomic_load_explicit( &(p_ring->head), memory_order_relaxed );
 
-    return p_list->head->data;
-}
+    // Only look at the producer's index when the cached one says there's too little.
+    if ( count > (p_ring->cached_tail - head) ) {
+        p_ring->cached_tail = atomic_load_explicit( &(p_ring->tail), memory_order_acquire );
+        if ( count > (p_ring->cached_tail - head) )
+            count = p_ring->cached_tail - head;
+    }
+    if ( 0 == count )  return 0;
 
+    size_t first = head & p_ring->mask;
+    size_t run = (p_ring->mask + 1) - first;
+    if ( run > count )  run = count;
 
-// Gets the final data element (TAIL) of the linked list.
-void* List__get_last( List_t* p_list ) {
-    ListNode_t* p_last = __List__get_last_node( p_list );
+    memcpy( pp_data, &(p_ring->slots[first]), (run * sizeof(void*)) );
+    memcpy( (pp_data + run), &(p_ring->slots[0]), ((count - run) * sizeof(void*)) );
 
-    return ( NULL == p_last ) ? NULL : p_last->data;
+    atomic_store_explicit( &(p_ring->head), (head + count), memory_order_release );
+
+    return count;
 }
 
 
-// Gets the data element at the selected index from the linked list.
-void* List__get_at( List_t* p_list, size_t index ) {
-    ListNode_t* p_node = __List__get_node_at( p_list, index );
 
-    return ( NULL == p_node ) ? NULL : p_node->data;
-}
 
+// Carve a new, empty node for an unrolled list out of its pool.
+static ListUnrolledNode_t* __List__unrolled_node_new( List_t* p_list ) {
+    ListUnrolledNode_t* p_node = (ListUnrolledNode_t*)LIST_NODE_INITIALIZER( p_list );
+    if ( NULL == p_node )  return NULL;
 
-// Returns the 0-based array index of the data pointer.
-int List__index_of( List_t* p_list, void* p_data ) {
-    ListNode_t* p_node = __List__get_node_first_occurrence( p_list, p_data );
+    p_node->next = NULL;
+    p_node->prev = NULL;
+    p_node->used = 0;
 
-    return __List__index_of_node( p_list, p_node );
+    return p_node;
 }
 
 
-// Returns the final 0-based array index of the data pointer.
-int List__last_index_of( List_t* p_list, void* p_data ) {
-    ListNode_t* p_node = __List__get_node_last_occurrence( p_list, p_data );
+// Find the node of an unrolled list holding the element at the given index, and the
+//   element's slot within it. The finger holds the last node found and the index of its
+//   first element, so lookups at or after it start from there; others in the back half
+//   walk back from the TAIL. NULL (and slot 0) if out of bounds.
+static ListUnrolledNode_t* __List__unrolled_seek( List_t* p_list, size_t index, size_t* p_slot ) {
+    *p_slot = 0;
+    if (  NULL == p_list || index >= p_list->count  )  return NULL;
+
+    ListUnrolledNode_t* p_node = LIST_UNROLLED_HEAD( p_list );
+    size_t first = 0;
+
+    if (  index >= (p_list->count - LIST_UNROLLED_TAIL( p_list )->used)  ) {
+        p_node = LIST_UNROLLED_TAIL( p_list );
+        first = p_list->count - p_node->used;
+    } else if (  NULL != p_list->p_finger && p_list->finger_index <= index  ) {
+        p_node = (ListUnrolledNode_t*)p_list->p_finger;
+        first = p_list->finger_index;
+    } else if (  index >= (p_list->count / 2)  ) {
+        p_node = LIST_UNROLLED_TAIL( p_list );
+        first = p_list->count - p_node->used;
+
+        while ( index < first ) {
+            p_node = p_node->prev;
+            first -= p_node->used;
+        }
+    }
 
-    return __List__index_of_node( p_list, p_node );
+    while ( index >= (first + p_node->used) ) {
+        first += p_node->used;
+        p_node = p_node->next;
+    }
+
+    p_list->p_finger = (ListNode_t*)p_node;
+    p_list->finger_index = first;
+
+    *p_slot = index - first;
+    return p_node;
 }
 
 
-// Pop off the current first element (HEAD) of the linked list, free the
-//    node (NOT the data), and return its data pointer.
-void* List__pop( List_t* p_list ) {
-    if (  NULL == p_list || NULL == p_list->head  )
-        return NULL;
+// Insert an element into an unrolled list at the given index, which may be the length
+//   of the list. A full node is split in half to make room, except at either end of the
+//   list, where a new node is started instead so that appending (or pushing) keeps every
+//   node full. Only a new HEAD moves the first index of the finger's node. Returns the
+//   new length, or -1 on failure.
+static int __List__unrolled_insert( List_t* p_list, void* p_data, size_t index ) {
+    if (
+           NULL == p_list
+        || index > p_list->count
+        || (p_list->count + 1) > p_list->max_size
+    )  return -1;
 
-    // Save head node information.
-    void* p_save = p_list->head->data;
-    ListNode_t* p_next = p_list->head->next;
+    ListUnrolledNode_t* p_tail = LIST_UNROLLED_TAIL( p_list );
+    ListUnrolledNode_t* p_head = LIST_UNROLLED_HEAD( p_list );
+    ListUnrolledNode_t* p_node;
+    size_t slot;
+
+    if (  p_list->count == index && (NULL == p_tail || LIST_UNROLLED_SLOTS == p_tail->used)  ) {
+        // Start a new TAIL. Earlier elements don't move, so the finger stays put.
+        p_node = __List__unrolled_node_new( p_list );
+        if ( NULL == p_node )  return -1;
+
+        if ( NULL == p_tail )
+            p_list->head = (ListNode_t*)p_node;
+        else
+            p_tail->next = p_node;
+        p_node->prev = p_tail;
+        p_list->tail = (ListNode_t*)p_node;
+        slot = 0;
+    } else if ( p_list->count == index ) {
+        p_node = p_tail;
+        slot = p_tail->used;
+    } else if (  0 == index && LIST_UNROLLED_SLOTS == p_head->used  ) {
+        // Start a new HEAD.
+        p_node = __List__unrolled_node_new( p_list );
+        if ( NULL == p_node )  return -1;
+
+        p_node->next = p_head;
+        p_head->prev = p_node;
+        p_list->head = (ListNode_t*)p_node;
+        p_list->finger_index++;
+        slot = 0;
+    } else {
+        p_node = __List__unrolled_seek( p_list, index, &slot );
+
+        if ( LIST_UNROLLED_SLOTS == p_node->used ) {
+            ListUnrolledNode_t* p_split = __List__unrolled_node_new( p_list );
+            if ( NULL == p_split )  return -1;
+
+            size_t keep = LIST_UNROLLED_SLOTS / 2;
+            p_split->used = LIST_UNROLLED_SLOTS - keep;
+            memcpy( p_split->data, &(p_node->data[keep]), (p_split->used * sizeof(void*)) );
+            p_node->used = keep;
+
+            p_split->next = p_node->next;
+            p_split->prev = p_node;
+            p_node->next = p_split;
+            if ( LIST_UNROLLED_TAIL( p_list ) == p_node )
+                p_list->tail = (ListNode_t*)p_split;
+            else
+                p_split->next->prev = p_split;
+
+            if ( slot > keep ) {
+                p_node = p_split;
+                slot -= keep;
+            }
+        }
+    }
 
-    // Free the old head and set it the the next/saved stack item.
-    free( p_list->head );
-    p_list->head = p_next;
+    memmove( &(p_node->data[slot + 1]), &(p_node->data[slot]), ((p_node->used - slot) * sizeof(void*)) );
+    p_node->data[slot] = p_data;
+    p_node->used++;
+    p_list->count++;
 
-    // Return the saved data pointer from the old head node.
-    return p_save;
+    return (int)p_list->count;
 }
 
 
-// Push a new HEAD element/node onto the linked list.
-int List__push( List_t* p_list, void* p_data ) {
-    size_t len = List__length( p_list );
-
+// Add or push a batch of elements onto an unrolled list, all or nothing.
+static int __List__unrolled_insert_many( List_t* p_list, void** pp_data, size_t count, bool at_head ) {
     if (
            NULL == p_list
-        || ((len + 1) > p_list->max_size)
+        || (NULL == pp_data && 0 != count)
+        || count > (p_list->max_size - p_list->count)
     )  return -1;
 
-    // New linked list node.
-    ListNode_t* p_node = LIST_NODE_INITIALIZER;
-    p_node->data = p_data;
+    // No run of inserts at either end needs more new nodes than this.
+    if (  !__List__pool_reserve( p_list, ((count / LIST_UNROLLED_SLOTS) + 1) )  )
+        return -1;
 
-    // Swap in the new list head.
-    p_node->next = p_list->head;
-    p_list->head = p_node;
+    for ( size_t x = 0; x < count; x++ )
+        __List__unrolled_insert( p_list, pp_data[x], (at_head ? 0 : p_list->count) );
 
-    return (len + 1);
+    return (int)p_list->count;
 }
 
 
-// Remove the first list item (HEAD) and return its data pointer. Wrapper for 'pop'.
-void* List__remove_first( List_t* p_list ) {
-    return List__pop( p_list );
-}
+// Insert a batch of elements into an unrolled list at the given index, in order and all
+//   or nothing. The node holding the index is cut in two there, and the batch goes in
+//   between as a run of full nodes. Returns the new length, or -1 on failure.
+static int __List__unrolled_insert_run( List_t* p_list, size_t index, void** pp_data, size_t count ) {
+    if ( index == p_list->count )
+        return __List__unrolled_insert_many( p_list, pp_data, count, false );
 
+    if (
+           index > p_list->count
+        || count > (p_list->max_size - p_list->count)
+    )  return -1;
 
-// Remove the final list item (TAIL) and return its data pointer.
-void* List__remove_last( List_t* p_list ) {
-    if ( NULL == p_list->head )  return NULL;
+    // One node for the back half of the cut, and as many full nodes as the batch needs.
+    if (  !__List__pool_reserve( p_list, (((count + LIST_UNROLLED_SLOTS - 1) / LIST_UNROLLED_SLOTS) + 1) )  )
+        return -1;
+
+    size_t slot;
+    ListUnrolledNode_t* p_node = __List__unrolled_seek( p_list, index, &slot );
+    ListUnrolledNode_t* p_prev = p_node->prev;
+    ListUnrolledNode_t* p_next = p_node;
+
+    if ( slot > 0 ) {
+        p_next = __List__unrolled_node_new( p_list );   // can't fail after the reservation
+        p_next->used = p_node->used - slot;
+        memcpy( p_next->data, &(p_node->data[slot]), (p_next->used * sizeof(void*)) );
+        p_node->used = slot;
+
+        p_next->next = p_node->next;
+        p_next->prev = p_node;
+        if ( NULL == p_node->next )
+            p_list->tail = (ListNode_t*)p_next;
+        else
+            p_node->next->prev = p_next;
+        p_node->next = p_next;
+        p_prev = p_node;
+    }
 
-    ListNode_t* p_tail = __List__get_last_node( p_list );
-    ListNode_t* p_head = p_list->head;
+    for ( size_t x = 0; x < count; ) {
+        ListUnrolledNode_t* p_new = __List__unrolled_node_new( p_list );
 
-    if ( p_tail == p_head ) {
-        p_list->head = NULL;
-    } else {
-        while ( NULL != p_head ) {
-            if ( p_head->next == p_tail ) {
-                p_head->next = NULL;   //sever list chain before the last node, cutting it out
-                break;
-            }
+        p_new->used = ((count - x) < LIST_UNROLLED_SLOTS) ? (count - x) : LIST_UNROLLED_SLOTS;
+        memcpy( p_new->data, &(pp_data[x]), (p_new->used * sizeof(void*)) );
+        x += p_new->used;
 
-            p_head = p_head->next;
-        }
+        p_new->prev = p_prev;
+        if ( NULL == p_prev )
+            p_list->head = (ListNode_t*)p_new;
+        else
+            p_prev->next = p_new;
+        p_prev = p_new;
     }
 
-    // Save the data pointer, free the ListNode_t object, and return the old data pointer.
-    void* p_save = p_tail->data;
-    free( p_tail );
+    p_prev->next = p_next;
+    p_next->prev = p_prev;
+    p_list->count += count;
 
-    return p_save;
+    // Cutting at the start of a node moves that node behind the batch.
+    if ( 0 == slot )
+        p_list->p_finger = NULL;
+
+    return (int)p_list->count;
 }
 
 
-// Remove the list node at the specified index and return its data pointer.
-void* List__remove_at( List_t* p_list, size_t index ) {
-    size_t len = List__length( p_list );
+// Unlink a node from an unrolled list and release it.
+static void __List__unrolled_unlink( List_t* p_list, ListUnrolledNode_t* p_node ) {
+    if ( NULL == p_node->prev )
+        p_list->head = (ListNode_t*)p_node->next;
+    else
+        p_node->prev->next = p_node->next;
+    if ( NULL == p_node->next )
+        p_list->tail = (ListNode_t*)p_node->prev;
+    else
+        p_node->next->prev = p_node->prev;
 
-    if (  0 == len || index >= len  )
-        return NULL;
+    LIST_NODE_RELEASE( p_list, (ListNode_t*)p_node );
+}
 
-    // Knock out easy cases first as applicable.
-    if ( 0 == index )
-        return List__pop( p_list );
-    else if (  (len - 1) == index  )
-        return List__remove_last( p_list );
 
-    // If the element is in the middle somewhere, pop it out and bridge.
-    ListNode_t* p_before = __List__get_node_at( p_list, (index-1) );
-    ListNode_t* p_target = p_before->next;
-    ListNode_t* p_after  = p_target->next;
+// Have a node of an unrolled list take in its successor when both fit in half a node.
+static void __List__unrolled_merge_next( List_t* p_list, ListUnrolledNode_t* p_node ) {
+    ListUnrolledNode_t* p_next = p_node->next;
 
-    // A NULL 'after' is OK since it's probably in some way the list tail.
-    if ( NULL == p_before || NULL == p_target )
-        return NULL;
+    if (  NULL == p_next || (p_node->used + p_next->used) > (LIST_UNROLLED_SLOTS / 2)  )
+        return;
+
+    memcpy( &(p_node->data[p_node->used]), p_next->data, (p_next->used * sizeof(void*)) );
+    p_node->used += p_next->used;
+    __List__unrolled_unlink( p_list, p_next );
+}
 
-    // Remove the node, saving its data pointer first, then bridge the gap.
-    void* p_save = p_target->data;
-    free( p_target );
 
-    p_before->next = p_after;
+// Remove the element at the given index from an unrolled list and return it. A node
+//   which empties is released, and a node takes in its successor when both fit in half
+//   a node, so the list stays mostly full.
+static void* __List__unrolled_remove( List_t* p_list, size_t index ) {
+    size_t slot;
+    ListUnrolledNode_t* p_node = __List__unrolled_seek( p_list, index, &slot );
+    if ( NULL == p_node )  return NULL;
+
+    void* p_save = p_node->data[slot];
+    p_node->used--;
+    memmove( &(p_node->data[slot]), &(p_node->data[slot + 1]), ((p_node->used - slot) * sizeof(void*)) );
+    p_list->count--;
+
+    // The seek left the finger on this node, whose first index doesn't change unless
+    //   the node itself goes away. Then the finger moves onto a neighbor, so walking a
+    //   list while removing from it doesn't seek from either end each time a node empties.
+    if ( 0 == p_node->used ) {
+        if ( NULL != p_node->next ) {
+            p_list->p_finger = (ListNode_t*)p_node->next;
+        } else if ( NULL != p_node->prev ) {
+            p_list->p_finger = (ListNode_t*)p_node->prev;
+            p_list->finger_index -= p_node->prev->used;
+        } else {
+            p_list->p_finger = NULL;
+        }
+
+        __List__unrolled_unlink( p_list, p_node );
+    } else {
+        __List__unrolled_merge_next( p_list, p_node );
+    }
 
     return p_save;
 }
 
 
-// Remove the first occurrence of the node data pointer.
-void* List__remove_first_occurrence( List_t* p_list, void* p_data ) {
-    int index = List__index_of( p_list, p_data );
-    if ( -1 == index )
-        return NULL;
+// Remove a run of elements from an unrolled list, releasing the nodes it empties. The
+//   nodes on either side of the gap are merged if they fit in half a node.
+static void __List__unrolled_remove_run( List_t* p_list, size_t index, size_t count ) {
+    size_t slot;
+    ListUnrolledNode_t* p_node = __List__unrolled_seek( p_list, index, &slot );
 
-    return List__remove_at( p_list, (size_t)index );
-}
+    p_list->count -= count;
+    p_list->p_finger = NULL;
 
+    while ( count > 0 ) {
+        size_t run = p_node->used - slot;
+        if ( run > count )  run = count;
 
-// Remove the final occurrence of the node data pointer.
-void* List__remove_last_occurrence( List_t* p_list, void* p_data ) {
-    int index = List__last_index_of( p_list, p_data );
-    if ( -1 == index )
-        return NULL;
+        memmove( &(p_node->data[slot]), &(p_node->data[slot + run]), ((p_node->used - slot - run) * sizeof(void*)) );
+        p_node->used -= run;
+        count -= run;
+
+        ListUnrolledNode_t* p_next = p_node->next;
+        if ( 0 == p_node->used )
+            __List__unrolled_unlink( p_list, p_node );
 
-    return List__remove_at( p_list, (size_t)index );
+        p_node = p_next;
+        slot = 0;
+    }
+
+    if (  index > 0 && index < p_list->count  )
+        __List__unrolled_merge_next( p_list, __List__unrolled_seek( p_list, (index - 1), &slot ) );
 }
 
 
-// Set the node data pointer at the selected location and return the old pointer.
-void* List__set_at( List_t* p_list, size_t index, void* p_new_data ) {
-    ListNode_t* p_node = __List__get_node_at( p_list, index );
-    if ( NULL == p_node )
-        return NULL;
+// Find the first (or last) index of a data pointer in an unrolled list. Like other
+//   lists, a NULL pointer is never found.
+static bool __List__unrolled_find( List_t* p_list, void* p_data, bool last, size_t* p_index ) {
+    if ( NULL == p_data )  return false;
 
-    // Swap data pointer and return the old pointer in case caller wants to free.
-    void* p_save = p_node->data;
-    p_node->data = p_new_data;
+    // Each node's slots are contiguous, so they're searched with the vector kernels.
+    ListPtrFind_t find = __List__ptr_find_kernel();
+    bool found = false;
+    size_t first = 0;
 
-    return p_save;
-}
+    for ( ListUnrolledNode_t* p_node = LIST_UNROLLED_HEAD( p_list ); NULL != p_node; p_node = p_node->next ) {
+        size_t slot = (*find)( p_node->data, p_node->used, p_data, last );
 
+        if ( slot != p_node->used ) {
+            found = true;
+            if ( NULL != p_index )  *p_index = first + slot;
+            if ( !last )  return true;
+        }
 
-// Return the length of a linked list.
-size_t List__length( List_t* p_list ) {
-    if ( NULL == p_list )  return 0;
+        first += p_node->used;
+    }
+
+    return found;
+}
 
-    size_t count = 0;
-    ListNode_t* p_node = p_list->head;
 
+// Reverse an unrolled list by swapping the links of each node and reversing its slots.
+static void __List__unrolled_reverse( List_t* p_list ) {
+    ListUnrolledNode_t* p_reversed = NULL;
+    ListUnrolledNode_t* p_node = LIST_UNROLLED_HEAD( p_list );
+
+    p_list->tail = p_list->head;
     while ( NULL != p_node ) {
-        count++;
-        p_node = p_node->next;
+        for ( size_t lo = 0, hi = p_node->used; lo + 1 < hi; lo++, hi-- ) {
+            void* p_swap = p_node->data[lo];
+            p_node->data[lo] = p_node->data[hi - 1];
+            p_node->data[hi - 1] = p_swap;
+        }
+
+        ListUnrolledNode_t* p_next = p_node->next;
+        p_node->next = p_reversed;
+        p_node->prev = p_next;
+        p_reversed = p_node;
+        p_node = p_next;
     }
 
-    return count;
+    p_list->head = (ListNode_t*)p_reversed;
+    p_list->p_finger = NULL;
 }
 
 
-// Wrapper/Alias function.
-size_t List__count( List_t* p_list ) {
-    return List__length( p_list );
-}
+// Reverse the elements between two inclusive indices of an unrolled list by swapping
+//   them pairwise, walking inward from both ends. The nodes themselves stay in place.
+static void __List__unrolled_reverse_range( List_t* p_list, size_t from_index, size_t to_index ) {
+    size_t lo_slot, hi_slot;
+    ListUnrolledNode_t* p_lo = __List__unrolled_seek( p_list, from_index, &lo_slot );
+    ListUnrolledNode_t* p_hi = __List__unrolled_seek( p_list, to_index, &hi_slot );
 
+    for ( size_t swaps = ((to_index - from_index) + 1) / 2; swaps > 0; swaps-- ) {
+        void* p_swap = p_lo->data[lo_slot];
+        p_lo->data[lo_slot] = p_hi->data[hi_slot];
+        p_hi->data[hi_slot] = p_swap;
 
-// Wrapper/Alias function.
-size_t List__size( List_t* p_list ) {
-    return List__length( p_list );
+        if ( ++lo_slot == p_lo->used ) {
+            p_lo = p_lo->next;
+            lo_slot = 0;
+        }
+
+        if ( 0 == hi_slot ) {
+            p_hi = p_hi->prev;
+            hi_slot = p_hi->used;
+        }
+        hi_slot--;
+    }
 }
 
 
-// Copy all linked list elements to a contiguous chunk of memory. NULL on error.
-void* List__to_array( List_t* p_list, size_t element_size, size_t extra_bytes ) {
-    // Calculate the necessary space.
-    size_t len = List__length( p_list );
-    size_t dest_size = (len * element_size);
+// Sort an unrolled list with a stable bottom-up merge sort over an array of its data
+//   pointers, then write them back into the same slots. Returns the length, or -1 if
+//   the arrays can't be allocated.
+static int __List__unrolled_sort( List_t* p_list, int (*cmp)(const void*, const void*) ) {
+    size_t count = p_list->count;
+    if (  count > (SIZE_MAX / (2 * sizeof(void*)))  )  return -1;
 
-    if ( 0 == dest_size )
-        return NULL;
+    void** pp_data = (void**)LIST_ALLOC( p_list, (2 * count * sizeof(void*)) );
+    if ( NULL == pp_data )  return -1;
 
-    // Allocate the array space.
-    void* const p_dest = calloc( 1, (dest_size + extra_bytes) );
-    if ( NULL == p_dest )
-        return NULL;
+    void** pp_from = pp_data;
+    void** pp_to = pp_data + count;
 
-    void* p_dest_scroll = p_dest;   //walking/scrolling pointer.
+    size_t x = 0;
+    for ( ListUnrolledNode_t* p_node = LIST_UNROLLED_HEAD( p_list ); NULL != p_node; p_node = p_node->next ) {
+        memcpy( &(pp_from[x]), p_node->data, (p_node->used * sizeof(void*)) );
+        x += p_node->used;
+    }
 
-    // Iterate all list data. If a null pointer exists, return error.
-    ListNode_t* p_node = p_list->head;
-    while ( NULL != p_node ) {
-        if ( NULL == p_node->data ) {
-            free( p_dest );
-            return NULL;
+    // Merge neighboring runs of each width from one array into the other. Ties are taken
+    //   from the left run to keep the sort stable.
+    for ( size_t width = 1; width < count; width *= 2 ) {
+        for ( size_t lo = 0; lo < count; lo += (2 * width) ) {
+            size_t mid = ((count - lo) > width) ? (lo + width) : count;
+            size_t hi = ((count - mid) > width) ? (mid + width) : count;
+            size_t left = lo, right = mid, out = lo;
+
+            while (  left < mid && right < hi  )
+                pp_to[out++] = ((*cmp)( pp_from[left], pp_from[right] ) <= 0) ? pp_from[left++] : pp_from[right++];
+            while ( left < mid )
+                pp_to[out++] = pp_from[left++];
+            while ( right < hi )
+                pp_to[out++] = pp_from[right++];
         }
 
-        memcpy( p_dest_scroll, p_node->data, element_size );
+        void** pp_swap = pp_from;
+        pp_from = pp_to;
+        pp_to = pp_swap;
+    }
 
-        p_node = p_node->next;
-        p_dest_scroll += element_size;
+    x = 0;
+    for ( ListUnrolledNode_t* p_node = LIST_UNROLLED_HEAD( p_list ); NULL != p_node; p_node = p_node->next ) {
+        memcpy( p_node->data, &(pp_from[x]), (p_node->used * sizeof(void*)) );
+        x += p_node->used;
     }
 
-    // Return the pointer to the populated array space.
-    return (void*)p_dest;
+    LIST_FREE( p_list, pp_data );
+    return (int)count;
 }
 
 
-// Create a new linked list from an array.
-List_t* List__from_array(
-    void* p_array,
-    size_t element_size,
-    size_t count,
-    size_t list_max_size
-) {
-    if (
-           NULL == p_array
-        || element_size <= 0
-        || count <= 0
-        || list_max_size < count
-    )  return NULL;
+// Repack the elements of a (non-empty) unrolled list into full nodes in a single new
+//   chunk, in list order, releasing all old node memory.
+static int __List__unrolled_compact( List_t* p_list ) {
+    ListNodePool_t* p_pool = &(p_list->pool);
+    size_t nodes = (p_list->count + LIST_UNROLLED_SLOTS - 1) / LIST_UNROLLED_SLOTS;
 
-    // Create the new list.
-    List_t* p_list = List__new( list_max_size );
-    ListNode_t* p_tmp = LIST_NODE_INITIALIZER;
+    ListNodeChunk_t* p_chunk = (ListNodeChunk_t*)LIST_ALLOC(
+        p_list, sizeof(ListNodeChunk_t) + (nodes * p_pool->node_size) );
+    if ( NULL == p_chunk )  return -1;
 
-    ListNode_t* p_scroll_prev = NULL;
+    p_chunk->next = NULL;
+    p_chunk->capacity = nodes;
+    p_chunk->used = nodes;
 
-    ListNode_t* p_scroll = p_tmp;
-    p_list->head = p_scroll;
+    ListUnrolledNode_t* p_packed = (ListUnrolledNode_t*)(p_chunk + 1);
+    for ( size_t x = 0; x < nodes; x++ ) {
+        p_packed[x].next = ((x + 1) < nodes) ? &(p_packed[x + 1]) : NULL;
+        p_packed[x].prev = (x > 0) ? &(p_packed[x - 1]) : NULL;
+        p_packed[x].used = 0;
+    }
 
-    // Walk the array. If at any point there's a failure, nuke the allocated nodes
-    //   to prevent memory leaks.
-    for ( size_t walk = 0; walk < count; walk++ ) {
+    // Fill each new node before moving on to the next one.
+    ListUnrolledNode_t* p_fill = p_packed;
+    for ( ListUnrolledNode_t* p_node = LIST_UNROLLED_HEAD( p_list ); NULL != p_node; p_node = p_node->next ) {
+        for ( size_t slot = 0; slot < p_node->used; ) {
+            if ( LIST_UNROLLED_SLOTS == p_fill->used )
+                p_fill = p_fill->next;
 
-        void* p_new_element = calloc( 1, element_size );
-        if ( NULL == p_new_element ) {
-            List__delete_deep( &p_list );
-            return NULL;
+            size_t run = LIST_UNROLLED_SLOTS - p_fill->used;
+            if ( run > (p_node->used - slot) )  run = p_node->used - slot;
+
+            memcpy( &(p_fill->data[p_fill->used]), &(p_node->data[slot]), (run * sizeof(void*)) );
+            p_fill->used += run;
+            slot += run;
         }
+    }
 
-        memcpy( p_new_element, (p_array+(walk*element_size)), element_size );
-        p_scroll->data = p_new_element;
+    p_list->head = (ListNode_t*)p_packed;
+    p_list->tail = (ListNode_t*)&(p_packed[nodes - 1]);
 
-        p_tmp = LIST_NODE_INITIALIZER;
-        p_scroll->next = p_tmp;
+    __List__pool_release( p_list );
+    p_pool->chunks = p_pool->current = p_chunk;
+    p_pool->capacity = p_chunk->capacity;
+    p_list->p_finger = NULL;
 
-        p_scroll_prev = p_scroll;
-        p_scroll = p_tmp;
-    }
+    return (int)p_list->count;
+}
 
-    // Clean up; sever the list appropriately and free the extra ListNode_t.
-    free( p_tmp );
-    p_scroll_prev->next = NULL;
 
-    // Return the pointer to the new list.
-    return p_list;
+// Run an action on a run of elements of an unrolled list, starting at a slot of a node.
+static void __List__unrolled_for_each(
+    ListUnrolledNode_t* p_node,
+    size_t slot,
+    size_t count,
+    void** pp_result,
+    void* p_input,
+    void (*action)(void*, void*, void**)
+) {
+    for ( ; count > 0; p_node = p_node->next, slot = 0 ) {
+        size_t run = p_node->used - slot;
+        if ( run > count )  run = count;
+
+        for ( size_t x = 0; x < run; x++ )
+            (*action)( p_node->data[slot + x], p_input, pp_result );
+        count -= run;
+    }
 }
 
 
-// For-each iterable functionality  [ or at least an attempt at it :') ].
-void List__for_each(
+// Copy a run of elements of an unrolled list into a new array allocated through the
+//   list's allocator, with some zeroed bytes after them. Fails (NULL) on any NULL element.
+static void* __List__unrolled_to_array(
     List_t* p_list,
-    void**  pp_result,
-    void*   p_input,
-    void    (*action)(void*, void*, void**),
-    void    (*callback)(void*, void**)
+    size_t from_index,
+    size_t count,
+    size_t element_size,
+    size_t extra_bytes
 ) {
-    if (
-           NULL == p_list
-        || NULL == p_list->head
-        || NULL == action
-    )  return;
+    size_t dest_size = count * element_size;
+    if ( 0 == dest_size )  return NULL;
 
-    ListNode_t* p_scroll = p_list->head;
-    while ( NULL != p_scroll ) {
-        (*action)( p_scroll->data, p_input, pp_result );
+    void** pp_data = __List__gather( p_list, from_index, count );
+    if ( NULL == pp_data )  return NULL;
 
-        p_scroll = p_scroll->next;
+    void* p_dest = NULL;
+    for ( size_t x = 0; x < count && 0 != dest_size; x++ )
+        if ( NULL == pp_data[x] )  dest_size = 0;
+
+    if (  0 != dest_size && NULL != (p_dest = LIST_ALLOC( p_list, (dest_size + extra_bytes) ))  ) {
+        for ( size_t x = 0; x < count; x++ )
+            memcpy( (char*)p_dest + (x * element_size), pp_data[x], element_size );
+        memset( (char*)p_dest + dest_size, 0, extra_bytes );
     }
 
-    if ( NULL != callback )
-        (*callback)( p_input, pp_result );
+    LIST_FREE( p_list, pp_data );
+    return p_dest;
 }
 
 
+// Point a cursor on an unrolled list back at the element at its index, after an edit
+//   which may have moved that element to another slot or node.
+static void __List__unrolled_cursor_seek( ListCursor_t* p_cursor ) {
+    size_t slot = 0;
 
+    p_cursor->p_node = (ListNode_t*)__List__unrolled_seek( p_cursor->p_list, p_cursor->index, &slot );
+    p_cursor->slot = slot;
+}
 
-//////////////////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////////////////
-// Internal functions.
 
-// Fetch the tail node of the list. NULL on error condition.
-static ListNode_t* __List__get_last_node( List_t* p_list ) {
-    if ( NULL == p_list )  return NULL;
+// Shallow clone of an unrolled list, copying its nodes whole with one pool reservation.
+static List_t* __List__unrolled_clone( List_t* p_list ) {
+    if ( 0 == p_list->count )  return NULL;
+
+    List_t* p_new = List__new_with_options( p_list->max_size, p_list->flags, &(p_list->allocator) );
+    if ( NULL == p_new )  return NULL;
+
+    size_t nodes = 0;
+    for ( ListUnrolledNode_t* p_node = LIST_UNROLLED_HEAD( p_list ); NULL != p_node; p_node = p_node->next )
+        nodes++;
 
-    ListNode_t* p_last = p_list->head;
-    while ( NULL != p_last ) {
-        if ( NULL == p_last->next )
-            break;
-        p_last = p_last->next;
+    if (  !__List__pool_reserve( p_new, nodes )  ) {
+        List__delete_shallow( &p_new );
+        return NULL;
     }
 
-    return p_last;
+    ListUnrolledNode_t* p_last = NULL;
+    for ( ListUnrolledNode_t* p_node = LIST_UNROLLED_HEAD( p_list ); NULL != p_node; p_node = p_node->next ) {
+        ListUnrolledNode_t* p_copy = __List__unrolled_node_new( p_new );   // can't fail after the reservation
+        p_copy->used = p_node->used;
+        memcpy( p_copy->data, p_node->data, (p_node->used * sizeof(void*)) );
+
+        if ( NULL == p_last )
+            p_new->head = (ListNode_t*)p_copy;
+        else
+            p_last->next = p_copy;
+        p_copy->prev = p_last;
+        p_last = p_copy;
+    }
+
+    p_new->tail = (ListNode_t*)p_last;
+    p_new->count = p_list->count;
+
+    return p_new;
 }
 
 
-// Fetch the node at the given index. NULL on error condition.
-static ListNode_t* __List__get_node_at( List_t* p_list, size_t index ) {
-    if (
-           NULL == p_list
-        || (index >= List__length( p_list ))
-     )  return NULL;
 
-    ListNode_t* p_node = p_list->head;
-    for ( size_t i = 0; i < index && NULL != p_node; i++ )
-        p_node = p_node->next;
+// Search an array of data pointers one slot at a time.
+static size_t __List__ptr_find_scalar( void* const* pp_data, size_t count, void* p_data, bool last ) {
+    if ( last ) {
+        for ( size_t x = count; x > 0; x-- )
+            if ( p_data == pp_data[x - 1] )  return (x - 1);
+    } else {
+        for ( size_t x = 0; x < count; x++ )
+            if ( p_data == pp_data[x] )  return x;
+    }
 
-    return p_node;
+    return count;
 }
 
 
-// Fetch the first occurrence of the node with the given data pointer.
-//   NULL on error condition or pointer not found.
-static ListNode_t* __List__get_node_first_occurrence( List_t* p_list, void* p_data ) {
-    if ( NULL == p_list || NULL == p_data )
-        return NULL;
+#ifdef LIST_SIMD_X86
+// Search an array of data pointers four slots per step with SSE2. SSE2 can't compare
+//   64-bit lanes, so both 32-bit halves of a lane must match.
+static size_t __List__ptr_find_sse2( void* const* pp_data, size_t count, void* p_data, bool last ) {
+    const __m128i needle = _mm_set1_epi64x( (long long)(uintptr_t)p_data );
+    size_t blocks = count / 4;
 
-    ListNode_t* p_node = p_list->head;
+    for ( size_t b = 0; b < blocks; b++ ) {
+        size_t x = last ? (count - ((b + 1) * 4)) : (b * 4);
 
-    while ( NULL != p_node ) {
-        if ( p_node->data == p_data )
-            return p_node;
+        __m128i lo = _mm_cmpeq_epi32( _mm_loadu_si128( (const __m128i*)&pp_data[x] ), needle );
+        __m128i hi = _mm_cmpeq_epi32( _mm_loadu_si128( (const __m128i*)&pp_data[x + 2] ), needle );
+        lo = _mm_and_si128( lo, _mm_shuffle_epi32( lo, _MM_SHUFFLE(2, 3, 0, 1) ) );
+        hi = _mm_and_si128( hi, _mm_shuffle_epi32( hi, _MM_SHUFFLE(2, 3, 0, 1) ) );
 
-        p_node = p_node->next;
+        unsigned int mask = (unsigned int)_mm_movemask_pd( _mm_castsi128_pd( lo ) )
+            | ((unsigned int)_mm_movemask_pd( _mm_castsi128_pd( hi ) ) << 2);
+        if ( 0 != mask )
+            return x + (size_t)(last ? (31 - __builtin_clz( mask )) : __builtin_ctz( mask ));
     }
 
-    return NULL;
+    // The slots left over sit at the end searched last.
+    size_t rest = count - (blocks * 4);
+    size_t found = __List__ptr_find_scalar( (last ? pp_data : &pp_data[blocks * 4]), rest, p_data, last );
+    if ( found == rest )  return count;
+
+    return last ? found : ((blocks * 4) + found);
 }
 
 
-// Fetch the last occurrence of the node with the given data pointer.
-//   NULL on error condition or pointer not found.
-static ListNode_t* __List__get_node_last_occurrence( List_t* p_list, void* p_data ) {
-    if ( NULL == p_list || NULL == p_data )
-        return NULL;
+// Search an array of data pointers eight slots per step with AVX2, then four. The rest
+//   is left to a plain loop: handing it to the SSE2 kernel would mix legacy SSE with
+//   AVX code, which stalls on many CPUs.
+__attribute__((target("avx2")))
+static size_t __List__ptr_find_avx2( void* const* pp_data, size_t count, void* p_data, bool last ) {
+    const __m256i needle = _mm256_set1_epi64x( (long long)(uintptr_t)p_data );
+    size_t done = 0;
 
-    ListNode_t* p_node = p_list->head;
-    ListNode_t* p_node_shadow = NULL;
+    for ( size_t step = 8; step >= 4; step -= 4 ) {
+        for ( ; (count - done) >= step; done += step ) {
+            size_t x = last ? (count - done - step) : done;
 
-    while ( NULL != p_node ) {
-        if ( p_node->data == p_data )
-            p_node_shadow = p_node;
+            unsigned int mask = (unsigned int)_mm256_movemask_pd( _mm256_castsi256_pd(
+                _mm256_cmpeq_epi64( _mm256_loadu_si256( (const __m256i*)&pp_data[x] ), needle ) ) );
+            if ( 8 == step )
+                mask |= (unsigned int)_mm256_movemask_pd( _mm256_castsi256_pd(
+                    _mm256_cmpeq_epi64( _mm256_loadu_si256( (const __m256i*)&pp_data[x + 4] ), needle ) ) ) << 4;
 
-        p_node = p_node->next;
+            if ( 0 != mask )
+                return x + (size_t)(last ? (31 - __builtin_clz( mask )) : __builtin_ctz( mask ));
+        }
     }
 
-    return p_node_shadow;
-}
-
+    // Fewer than four slots are left, at the end searched last.
+    size_t rest = count - done;
+    for ( size_t x = 0; x < rest; x++ ) {
+        size_t at = last ? (rest - 1 - x) : (done + x);
+        if ( p_data == pp_data[at] )  return at;
+    }
 
-// Get the index of the node pointer (NOT THE DATA OF THE NODE) from the linked list HEAD.
-static size_t __List__index_of_node( List_t* p_list, ListNode_t* p_node ) {
-    size_t index = 0;
-    size_t list_len = List__length( p_list );
+    return count;
+}
+#endif
 
-    ListNode_t* p_scroll = p_list->head;
 
-    do {
-        if ( p_scroll == p_node )
-            return index;
+// Get the pointer search kernel for this CPU, picking it on the first call. Racing
+//   callers all pick the same kernel.
+static ListPtrFind_t __List__ptr_find_kernel( void ) {
+    ListPtrFind_t find = atomic_load_explicit( &__list_ptr_find, memory_order_relaxed );
+    if ( NULL != find )  return find;
 
-        index++;
-        p_scroll = p_scroll->next;
-    } while ( NULL != p_scroll && index < list_len );
+    find = __List__ptr_find_scalar;
+#ifdef LIST_SIMD_X86
+    // SSE2 is part of x86-64 itself.
+    __builtin_cpu_init();
+    find = __builtin_cpu_supports( "avx2" ) ? __List__ptr_find_avx2 : __List__ptr_find_sse2;
+#endif
 
-    return -1;
+    atomic_store_explicit( &__list_ptr_find, find, memory_order_relaxed );
+    return find;
 }
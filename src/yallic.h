@@ -35,10 +35,80 @@
 
 /**
  * The primary, generic linked-list structure.
- *   The structure simply maintains a max_count with a HEAD pointer.
+ *   The structure maintains a max_count with HEAD and TAIL pointers and a running
+ *   element count, so length queries and tail access are constant-time.
  */
 typedef struct __linked_list_t List_t;
 
+/**
+ * A reusable pool of worker threads for parallel list operations. The threads are started
+ *   once, when the pool is created, and sleep between jobs. A pool runs one job at a time;
+ *   concurrent callers simply take turns.
+ */
+typedef struct __linked_list_thread_pool_t ListThreadPool_t;
+
+/**
+ * A set of memory management callbacks used by a linked list for _every_ allocation it
+ *   makes: the list structure itself, its node chunks, element copies made by operations
+ *   like `List__copy`, and the buffers returned from `List__to_array` and
+ *   `List__to_ptr_array`. This allows lists
+ *   to be backed by arenas, bump allocators, NUMA-local allocators, and so on.<br />A list
+ *   keeps its own copy of the structure, so the original need not outlive the list.
+ */
+typedef struct __linked_list_allocator_t {
+    void* (*alloc)( size_t size, void* p_context );   /**< Allocate _size_ bytes; the memory does not need to be zeroed. Returns NULL on failure. */
+    void  (*free)( void* p_ptr, void* p_context );   /**< Release a block returned by _alloc_. Must accept NULL. */
+    void* p_context;   /**< An opaque pointer handed to each callback, such as an arena handle. */
+} ListAllocator_t;
+
+/**
+ * Optional behaviors which are chosen when a linked list is created and stay fixed for
+ *   the lifetime of the list. Flags can be combined with a bitwise OR. Lists derived from
+ *   another list (clones, slices, copies, etc.) inherit its flags.
+ */
+typedef enum __linked_list_flags_t {
+    LIST_FLAGS_NONE = 0,   /**< A plain, singly-linked list. */
+    LIST_DOUBLY_LINKED = (1 << 0),   /**< Nodes also point to their predecessor. This costs one extra pointer per element, but makes `List__remove_last` constant-time, lets `List__last_index_of` and `List__remove_last_occurrence` scan backward from the tail, and lets `List__get_at` walk from whichever end is closer. */
+    LIST_INDEXED = (1 << 1),   /**< Keeps a skip index of express pointers with span counts over the node chain, so `List__get_at`, `List__set_at`, `List__add_at`, `List__remove_at` and `List__slice` find their positions in O(log n). Each node costs one extra pointer, and about one node in four also carries a small tower of express links. Operations which do not know the positions they touch (such as `List__reverse`) mark the index stale, and it is rebuilt in a single pass on the next positional access. */
+    LIST_HASHED = (1 << 2),   /**< Keeps an open-addressing hash from data pointers to their nodes, so `List__contains` and `List__remove_first_occurrence` are O(1) on average, and `List__index_of` and `List__last_index_of` answer instantly for pointers which are not in the list. Implies LIST_DOUBLY_LINKED. The table holds one 24-byte slot per _distinct_ data pointer and is kept at most half full, costing roughly 48 to 96 bytes per distinct pointer on top of the 8-byte back-pointer in every node. NULL data pointers are never indexed. */
+    LIST_CONCURRENT_STACK = (1 << 3),   /**< Turns the list into a lock-free stack which any number of threads can `List__push` onto and `List__pop` from at once, with `max_size` still enforced. The top of the stack is swapped with C11 compare-and-swap operations on a tagged pointer (a 16-bit generation tag rides in the pointer's unused upper bits on 64-bit targets) which guards against ABA, and popped nodes are recycled through a second lock-free stack; only growing the node pool takes a brief lock. `List__length` reads an atomic count, while `List__clear_*` and `List__delete_*` must only be called once no other thread uses the list. Every other operation refuses such lists. Cannot be combined with other flags. */
+    LIST_CONCURRENT_QUEUE = (1 << 4),   /**< Turns the list into a lock-free FIFO queue (Michael & Scott) which any number of threads can `List__add` onto and `List__pop`/`List__remove_first` from at once, with `max_size` still enforced. HEAD and TAIL are tagged pointers swapped with C11 compare-and-swap operations, as are the node links, and dequeued nodes are recycled through a lock-free free list so no node is released while another thread may still read it. The same rules as LIST_CONCURRENT_STACK apply to every other operation. Cannot be combined with other flags. */
+    LIST_SPSC_RING = (1 << 5),   /**< Turns the list into a bounded FIFO ring buffer for exactly one producer thread, which may `List__add`/`List__add_many`, and one consumer thread, which may `List__pop`/`List__pop_many`/`List__remove_first`, running at once. No nodes are used: the slots are one array sized to `max_size` (rounded up to a power of two), so `max_size` cannot be _0_ and `List__resize` cannot go past that array. Producer and consumer each publish their own index with release/acquire ordering on separate cache lines. The same rules as LIST_CONCURRENT_STACK apply to every other operation. Cannot be combined with other flags. */
+    LIST_COPY_ON_WRITE = (1 << 6),   /**< Makes `List__clone` constant-time: the clone shares the source's nodes rather than copying them, as does a `List__slice` which runs to the end of a singly-linked list. Shared nodes are reference-counted, and a list only copies its chain (once, with a single pool reservation) the first time it is changed; the last list still holding a shared chain takes it back without copying. Reading a shared list never allocates, so read-only clones cost one List_t each. Cannot be combined with LIST_INDEXED, whose towers live inside the nodes. */
+    LIST_UNROLLED = (1 << 7),   /**< Stores the list's elements in runs: each node holds up to 13 data pointers (on 64-bit targets) in an array filling two cache lines, plus its links and a fill count. Elements added or pushed at either end fill each node before starting another, costing about 10 bytes per element instead of 16, and walking the list reads consecutive pointers instead of chasing one node per element. Inserting into a full node splits it in half, and removing merges thin nodes back together. Every operation works on these lists: positional and bulk operations seek node by node, starting from the last node they found, `List__sort` sorts an array of the data pointers and writes it back, `List__compact` repacks the elements into full nodes in one chunk, and `List__extend`, `List__merge`, `List__splice_range` and `List__slice` copy runs of data pointers between unrolled and regular lists alike. Because elements move between slots, cursor edits re-seek their position; they stay constant-time on average. Cannot be combined with other flags. */
+} ListFlags_t;
+
+/**
+ * A position within a linked list, used to walk and edit a list in a single pass. Every
+ *   cursor operation is constant-time, so filtering or splicing a list element-by-element
+ *   through a cursor is linear overall.<br />A cursor sits either _on_ an element or at the
+ *   _end_ of the list (just past its last element). Changing the list through anything
+ *   other than the cursor itself invalidates the cursor.<br />Cursors are small values
+ *   which can live on the stack; they own no memory and never need to be released.
+ */
+typedef struct __linked_list_cursor_t {
+    List_t* p_list;   /**< The list the cursor walks. */
+    struct __linked_list_node_t* p_prev;   /**< Internal: the node before the cursor position. NULL at the HEAD. */
+    struct __linked_list_node_t* p_node;   /**< Internal: the node at the cursor position. NULL at the end. */
+    size_t index;   /**< The 0-based index of the cursor position. */
+    size_t slot;   /**< Internal: the slot of the cursor position within its node, for LIST_UNROLLED lists. */
+} ListCursor_t;
+
+/**
+ * A read-only window onto a run of consecutive elements of a linked list. Views copy
+ *   nothing and own no memory: they remember where the run starts and how long it is,
+ *   so taking one costs a single seek and reading it costs only what is read. Like
+ *   cursors, views are small values, and any change to the list invalidates them.
+ */
+typedef struct __linked_list_view_t {
+    List_t* p_list;   /**< The list the view looks into. NULL for an empty view. */
+    struct __linked_list_node_t* p_prev;   /**< Internal: the node before the first viewed node. NULL at the HEAD. */
+    struct __linked_list_node_t* p_first;   /**< Internal: the first viewed node. */
+    size_t from_index;   /**< The index in the list of the first viewed element. */
+    size_t length;   /**< The amount of viewed elements. */
+    size_t slot;   /**< Internal: the slot of the first viewed element within its node, for LIST_UNROLLED lists. */
+} ListView_t;
+
 
 
 /**
@@ -51,6 +121,49 @@ typedef struct __linked_list_t List_t;
  */
 List_t* List__new( size_t max_size );
 
+/**
+ * Initialize a new linked list which performs all of its memory management through the
+ *   given allocator callbacks. Lists derived from this list (clones, slices, copies, etc.)
+ *   inherit the same allocator. Deep clears and deletions release node data through the
+ *   allocator's _free_ callback, so data in such lists should come from the same allocator.
+ *
+ * @param max_size Maximum size of the created linked list. If this is set to 0 or NULL,
+ *   the library assumes no theoretical limit to the length of the linked list.
+ * @param p_allocator The allocator callbacks to use. NULL selects the C library's
+ *   `malloc` and `free`, which is what `List__new` uses.
+ * @return A pointer to the allocated linked list. NULL on error.
+ */
+List_t* List__new_with_allocator( size_t max_size, const ListAllocator_t* p_allocator );
+
+/**
+ * Initialize a new linked list with optional behaviors enabled.
+ *
+ * @param max_size Maximum size of the created linked list. If this is set to 0 or NULL,
+ *   the library assumes no theoretical limit to the length of the linked list.
+ * @param flags A bitwise OR of ListFlags_t values.
+ * @return A pointer to the allocated linked list. NULL on error or unknown flags.
+ */
+List_t* List__new_with_flags( size_t max_size, unsigned int flags );
+
+/**
+ * Initialize a new linked list with optional behaviors enabled, which also performs all of
+ *   its memory management through the given allocator callbacks.
+ *
+ * @param max_size Maximum size of the created linked list. If this is set to 0 or NULL,
+ *   the library assumes no theoretical limit to the length of the linked list.
+ * @param flags A bitwise OR of ListFlags_t values.
+ * @param p_allocator The allocator callbacks to use. NULL selects `malloc` and `free`.
+ * @return A pointer to the allocated linked list. NULL on error or unknown flags.
+ *
+ * @see List__new_with_allocator
+ * @see List__new_with_flags
+ */
+List_t* List__new_with_options(
+    size_t max_size,
+    unsigned int flags,
+    const ListAllocator_t* p_allocator
+);
+
 /**
  * Destroy a linked list. If the list hasn't been cleared--meaning a count-check on
  *   the list is greater than 0--then this function will attempt a shallow clear on
@@ -76,16 +189,59 @@ void List__delete_shallow( List_t** pp_list );
 void List__delete_deep( List_t** pp_list );
 
 /**
- * Reverse the order of a linked list object. This function takes a double-pointer since
- *   it effectly does a shallow deletion of the old list and creates a new one. Therefore,
- *   it needs to modify a passed pointer by reference.
+ * Reverse the order of a linked list object. The list's nodes are relinked in place in a
+ *   single pass, so no memory is allocated or freed. The double-pointer is kept for
+ *   compatibility with older releases, which built a new list here; the list it points
+ *   to is no longer replaced.
  *
  * @param pp_list Double-pointer to a valid linked list to reverse.
- * @return Nothing. However, the value of the pointer from the param dereference is set
- *   to the newly-formed, reversed list.
+ * @return Nothing. The list pointed to by the param dereference is reversed.
  */
 void List__reverse( List_t** pp_list );
 
+/**
+ * Reverse the order of a sub-range of a linked list in place. The two given indices are
+ *   _inclusive_, so reversing 1-3 of [A,B,C,D,E] yields [A,D,C,B,E]. No memory is
+ *   allocated or freed.
+ *
+ * @param p_list The target linked list.
+ * @param from_index The first index of the range to reverse.
+ * @param to_index The last index of the range to reverse.
+ * @return _-1_ on failure or out-of-bounds indices, or the amount of reversed elements.
+ */
+int List__reverse_range( List_t* p_list, size_t from_index, size_t to_index );
+
+/**
+ * Sort a linked list in place with a stable, bottom-up merge sort. The existing nodes are
+ *   relinked, so no memory is allocated and only constant extra space is used. Elements
+ *   which compare as equal keep their relative order.
+ *
+ * @param p_list The target linked list.
+ * @param cmp The comparator. Unlike with `qsort`, it receives the two elements' _data
+ *   pointers_ themselves, and returns a negative, zero, or positive value when the first
+ *   element sorts before, equal to, or after the second.
+ * @return _-1_ on failure, or the length of the sorted list.
+ */
+int List__sort( List_t* p_list, int (*cmp)(const void*, const void*) );
+
+/**
+ * Sort a linked list in place across several POSIX threads. The chain is cut into one
+ *   contiguous run per thread, the runs are sorted concurrently, and neighboring runs
+ *   are then merged pairwise (also concurrently) until one run is left. The result is
+ *   _identical_ to that of `List__sort`, including the order of equal elements.<br />
+ *   Lists too short to be worth splitting are simply sorted on the calling thread, as
+ *   is any run whose thread could not be started.
+ *
+ * @param p_list The target linked list.
+ * @param cmp The comparator, which receives two data pointers as with `List__sort`. It is
+ *   called from several threads at once.
+ * @param nthreads The most threads to use, including the calling thread.
+ * @return _-1_ on failure, or the length of the sorted list.
+ *
+ * @see List__sort
+ */
+int List__sort_parallel( List_t* p_list, int (*cmp)(const void*, const void*), size_t nthreads );
+
 /**
  * Change a linked list's maximum capacity. If the new capacity is lower than the current
  *   count of elements in the list, an error is returned and nothing is changed. Otherwise,
@@ -107,9 +263,10 @@ size_t List__resize( List_t* p_list, size_t new_max_size );
 size_t List__get_max_size( List_t* p_list );
 
 /**
- * Shallow clear of list nodes. Deletes and frees all list nodes, but does _NOT_ attempt
- *   to free the values to which the nodes point. Any lists which have nodes pointing to
- *   the same underlying data (clones) are _not affected_.
+ * Shallow clear of list nodes. Deletes all list nodes, but does _NOT_ attempt to free
+ *   the values to which the nodes point. Any lists which have nodes pointing to the same
+ *   underlying data (clones) are _not affected_.<br />The memory backing the nodes is
+ *   kept by the list for reuse; see `List__shrink_to_fit` to give it back.
  *
  * @param p_list The target linked list.
  */
@@ -120,12 +277,38 @@ void List__clear_shallow( List_t* p_list );
  *   data pointers. Any clones (shallow copies) of the provided list should be deleted or
  *   attempts to dereference underlying data can result in undefined behavior. Additionally,
  *   attempts to use this on lists containing unallocated node data pointers will also
- *   result in undefined or problematic behavior.
+ *   result in undefined or problematic behavior. Data pointers are released through the
+ *   list's allocator, which is the C library's `free` unless one was provided.
  *
  * @param p_list The target linked list.
  */
 void List__clear_deep( List_t* p_list );
 
+/**
+ * Release unused node memory held by a linked list. Every list allocates its nodes
+ *   from large chunks and keeps removed nodes around for reuse; this frees each chunk
+ *   which no longer holds any list nodes. Nodes are not moved, so data pointers and
+ *   node order are unaffected.
+ *
+ * @param p_list The target linked list.
+ * @return The amount of nodes the list can still hold without allocating memory,
+ *   including the ones in use.
+ */
+size_t List__shrink_to_fit( List_t* p_list );
+
+/**
+ * Move every node of a linked list into one new block of memory, in list order, and free
+ *   all of the old node memory. After lots of insertions and removals a list's nodes are
+ *   scattered across its node chunks; compacting it makes later walks read memory
+ *   sequentially. Data pointers and element order are unaffected, but cursors on the list
+ *   become invalid, and indexed or hashed lists rebuild their structures on next use.
+ *
+ * @param p_list The target linked list.
+ * @return The list length on success, or _-1_ on failure, in which case the list is
+ *   left as it was.
+ */
+int List__compact( List_t* p_list );
+
 
 /**
  * Add a node to the _tail end_ of the linked list. If the addition of the new node would
@@ -137,6 +320,21 @@ void List__clear_deep( List_t* p_list );
  */
 int List__add( List_t* p_list, void* p_data );
 
+/**
+ * Add a batch of nodes to the _tail end_ of the linked list, in array order. Either all
+ *   of the elements are added or, if that would exceed the list's size limit or run out
+ *   of memory, none of them are. The size limit is checked once, all new nodes are taken
+ *   from the node pool with at most one allocation, and they are linked in a single pass,
+ *   so this is much faster than calling `List__add` in a loop. LIST_SPSC_RING lists move
+ *   the whole batch with a single index update, so this is their fastest way to produce.
+ *
+ * @param p_list The target linked list.
+ * @param pp_data An array of data pointers to add.
+ * @param count The amount of data pointers in the array.
+ * @return _-1_ on failure, or the new list length on success.
+ */
+int List__add_many( List_t* p_list, void** pp_data, size_t count );
+
 /**
  * Add a node to the linked list at the given 0-based index position. If adding the node
  *   to the list causes the tail of the list to go out-of-bounds (beyond the max_size),
@@ -163,7 +361,10 @@ int List__extend( List_t* p_list_dest, List_t* p_list_src );
 /**
  * Concatenate two lists in sequence. If the list concatenation causes the destination
  *   list length to go out-of-bounds, the operation will fail and is reverted. The source
- *   list is __shallowly freed__ upon success.
+ *   list is __shallowly freed__ upon success.<br />When both lists have the same node
+ *   layout (the same LIST_DOUBLY_LINKED and LIST_INDEXED flags) and allocator, the source
+ *   nodes are moved over instead of copied: no memory is allocated, and plain lists are
+ *   joined in constant time, plus a walk over the source's node chunks and free nodes.
  *
  * @param p_list_dest The destination list onto which the source list is added.
  * @param p_list_src The list being added onto the destination list.
@@ -187,7 +388,8 @@ int List__extend_at( List_t* p_list_dest, List_t* p_list_src, size_t index );
 /**
  * Insert a list into another linked list at the given destination index. If the list
  *   concatenation causes the destiation list length to go out-of-bounds, the operation
- *   will fail and is reverted. The source list is __shallowly freed__ upon success.
+ *   will fail and is reverted. The source list is __shallowly freed__ upon success. Nodes
+ *   are moved rather than copied under the same conditions as `List__merge`.
  *
  * @param p_list_dest The destination list into which the source list is added.
  * @param p_list_src The list being added into the destination list.
@@ -196,12 +398,34 @@ int List__extend_at( List_t* p_list_dest, List_t* p_list_src, size_t index );
  */
 int List__merge_at( List_t* p_list_dest, List_t* p_list_src, size_t index );
 
+/**
+ * Move a range of elements out of one list and into another at the given destination
+ *   index. Like `List__slice`, the two source indices are _inclusive_. The elements are
+ *   removed from the source list and keep their order in the destination. If the move
+ *   would take the destination list out-of-bounds, nothing is changed.
+ *
+ * @param p_list_dest The destination list into which the range is moved.
+ * @param index The index into the destination list at which to insert the range.
+ * @param p_list_src The list the range is taken out of. Cannot be the destination list.
+ * @param from_index The index of the first element to move.
+ * @param to_index The index of the last element to move.
+ * @return _-1_ on failure, or the new length of the destination list on success.
+ */
+int List__splice_range(
+    List_t* p_list_dest,
+    size_t index,
+    List_t* p_list_src,
+    size_t from_index,
+    size_t to_index
+);
+
 
 /**
  * Create a cloned (shallow) linked list from a subset of a larger source list. The
  *   two given indices are _inclusive_, meaning a range of 1-2 will include _both_
  *   elements 1 and 2 in the resulting subset clone, 2-5 will include elements 2, 3,
- *   4, & 5 in it, etc. etc.
+ *   4, & 5 in it, etc. etc.<br />A slice of a singly-linked LIST_COPY_ON_WRITE list
+ *   which runs through the final element shares its nodes with the source list.
  *
  * @param p_list The list to slice.
  * @param from_index The starting index to slice from *p_list*.
@@ -215,7 +439,8 @@ List_t* List__slice( List_t* p_list, size_t from_index, size_t to_index );
 /**
  * Create a shallow copy of the given linked list and return a new linked list
  *   pointer. Shallow copies do not independently copy the underlying node data,
- *   only the structure of the linked list itself.
+ *   only the structure of the linked list itself. Clones of LIST_COPY_ON_WRITE lists
+ *   share the source's nodes until either list is changed.
  *
  * @param p_list The list to copy.
  * @return A pointer to the list shallow copy. NULL on failure.
@@ -234,10 +459,27 @@ List_t* List__clone( List_t* p_list );
  */
 List_t* List__copy( List_t* p_list, size_t element_size );
 
+/**
+ * Fully and deeply copy a linked list like `List__copy`, but pack the copy into two
+ *   allocations: one for all of its nodes and one for all of its elements, both laid out
+ *   in list order. Walking the copy reads memory sequentially, and deep-clearing or
+ *   deleting it frees those blocks once instead of every element separately. The copied
+ *   elements are owned by the list and must never be freed (or removed and freed)
+ *   individually; elements added to the copy later belong to the caller as usual. NULL
+ *   elements stay NULL.
+ *
+ * @param p_list The target linked list to copy.
+ * @param element_size The size of each of the underlying list elements.
+ * @return Pointer to the newly-copied, independent linked list. _NULL_ on error.
+ */
+List_t* List__copy_contiguous( List_t* p_list, size_t element_size );
+
 
 /**
  * Search a list for the presence of a data pointer. If the data pointer is found in
- *   the linked list, its first occurrence index is returned.
+ *   the linked list, its first occurrence index is returned.<br />
+ * LIST_UNROLLED lists compare up to 8 pointers per step with AVX2 or SSE2 when the CPU
+ *   has them, which also speeds up `List__index_of` and `List__last_index_of`.
  *
  * @param p_list The target linked list.
  * @param p_data The object/reference to seek inside the linked list.
@@ -274,7 +516,10 @@ void* List__get_last( List_t* p_list );
 
 /**
  * Return the data pointer from the selected list element. If the linked list is empty,
- *   or the index is not valid, this will return _NULL_.
+ *   or the index is not valid, this will return _NULL_.<br />Every list remembers the
+ *   last node it found by index, and lookups at or after that index (or near it, on
+ *   doubly-linked lists) walk from there. Stepping through a list by index, including
+ *   with `List__set_at`, `List__add_at` and `List__remove_at`, is linear overall.
  *
  * @param p_list The target linked list.
  * @param index The 0-based index into the array to select.
@@ -317,6 +562,20 @@ int List__last_index_of( List_t* p_list, void* p_data );
  */
 void* List__pop( List_t* p_list );
 
+/**
+ * Pop up to the given amount of elements off the front (HEAD) of a LIST_SPSC_RING list, in
+ *   order, and store their data pointers into an array. The whole batch is moved with a
+ *   single index update, so this is the ring's fastest way to consume. Other lists pop
+ *   nothing.
+ *
+ * @param p_list The target linked list.
+ * @param pp_data The array which receives the popped data pointers.
+ * @param count The most elements to pop; the array must fit this many pointers.
+ * @return The amount of elements popped, which is less than _count_ if the ring ran out,
+ *   and _0_ for any other list.
+ */
+size_t List__pop_many( List_t* p_list, void** pp_data, size_t count );
+
 /**
  * Push a new element onto the first (HEAD) element of a list's node stack. This is a
  *   convenient way to use the linked list as a stack structure in tandem with the 'pop'
@@ -328,6 +587,18 @@ void* List__pop( List_t* p_list );
  */
 int List__push( List_t* p_list, void* p_data );
 
+/**
+ * Push a batch of elements onto the HEAD of a list's node stack, as if each one was pushed
+ *   in array order: the _last_ element of the array becomes the new HEAD. Like
+ *   `List__add_many`, the batch is added all at once or not at all.
+ *
+ * @param p_list The target linked list.
+ * @param pp_data An array of data pointers to push.
+ * @param count The amount of data pointers in the array.
+ * @return The new list length on success, _-1_ on failure (such as an out-of-bounds error).
+ */
+int List__push_many( List_t* p_list, void** pp_data, size_t count );
+
 
 /**
  * Remove the first list node element from the list and returns its data pointer. If the
@@ -428,10 +699,47 @@ size_t List__size( List_t* p_list );
  * @param p_list The target linked list.
  * @param element_size The expected size of the underlying linked list type.
  * @param extra_bytes Amount of extra bytes to add onto the calloc memory allocation.
- * @return Pointer to the newly-allocated array on the heap. _NULL_ on error.
+ * @return Pointer to the newly-allocated, zeroed array on the heap. _NULL_ on error. The
+ *   array is allocated through the list's allocator and should be released with it.
  */
 void* List__to_array( List_t* p_list, size_t element_size, size_t extra_bytes );
 
+/**
+ * Export list elements into a caller-provided buffer, one chunk at a time. Elements are
+ *   copied like `List__to_array` does, starting at the cursor's position, until the buffer
+ *   is full or the list ends, and the cursor is moved past the exported elements. Calling
+ *   this again with the same cursor and a reused buffer streams the whole list out in
+ *   fixed-size chunks without any allocations. Elements with a NULL data pointer are
+ *   exported as zeroed bytes.
+ *
+ * @param p_list The target linked list.
+ * @param p_buffer The buffer which receives the element copies.
+ * @param buffer_size The size of the buffer in bytes; only whole elements are written.
+ * @param element_size The expected size of the underlying linked list type.
+ * @param p_cursor A cursor on _p_list_, from `List__cursor_begin` or previous calls.
+ * @return The amount of elements written to the buffer. _0_ once the cursor reaches the end
+ *   of the list, or on error.
+ */
+size_t List__to_array_into(
+    List_t* p_list,
+    void* p_buffer,
+    size_t buffer_size,
+    size_t element_size,
+    ListCursor_t* p_cursor
+);
+
+/**
+ * Gather the data pointers of a linked list, in order, into a new array. Unlike
+ *   `List__to_array`, no element memory is read or copied, so this works for lists of
+ *   any element type (and NULL elements).
+ *
+ * @param p_list The target linked list.
+ * @return A newly-allocated array of _List__length_ data pointers. _NULL_ if the list is
+ *   empty or on error. The array is allocated through the list's allocator and should be
+ *   released with it.
+ */
+void** List__to_ptr_array( List_t* p_list );
+
 /**
  * Convert an array of data to a linked list. This linearly iterates all memory in the source
  *   array, stepping by the given size up to the given count, and _copies_ data into a
@@ -447,6 +755,37 @@ void* List__to_array( List_t* p_list, size_t element_size, size_t extra_bytes );
  */
 List_t* List__from_array( void* p_array, size_t element_size, size_t count, size_t list_max_size );
 
+/**
+ * Convert an array of data to a linked list like `List__from_array`, but copy all elements
+ *   into _one_ contiguous block owned by the list instead of one allocation per element.
+ *   The list frees that block itself when it is deep-cleared or deleted either way, so
+ *   its elements must never be freed (or removed and freed) individually. Elements added
+ *   to the list later are unaffected and belong to the caller as usual.
+ *
+ * @param p_array The initial contiguous segment of array data to read into a linked list.
+ * @param element_size The size of each independent array element.
+ * @param count The amount of array elements to copy into the linked list.
+ * @param list_max_size The maximum size of the resulting linked list. _Cannot_ be less than
+ *   the provided _count_ parameter.
+ * @return A new linked list holding its own copy of the data. _NULL_ on error.
+ */
+List_t* List__from_array_contiguous( void* p_array, size_t element_size, size_t count, size_t list_max_size );
+
+/**
+ * Build a linked list which points _directly_ into an array, without copying anything:
+ *   each node's data pointer is the address of one array element. All nodes come from a
+ *   single allocation. The array must outlive the list, and the list must only ever be
+ *   released with _shallow_ clears or deletes, since it doesn't own the elements.
+ *
+ * @param p_array The initial contiguous segment of array data to wrap.
+ * @param element_size The size of each array element.
+ * @param count The amount of array elements to wrap.
+ * @param list_max_size The maximum size of the resulting linked list. _Cannot_ be less than
+ *   the provided _count_ parameter.
+ * @return A new linked list whose elements are the array's elements. _NULL_ on error.
+ */
+List_t* List__wrap_array( void* p_array, size_t element_size, size_t count, size_t list_max_size );
+
 
 
 /**
@@ -476,6 +815,223 @@ void List__for_each(
     void    (*callback)(void*, void**)
 );
 
+/**
+ * Iterate the elements in a linked list on a pool of worker threads. The list is split into
+ *   contiguous chunks which the workers (and the calling thread) take turns claiming. Each
+ *   chunk accumulates into its own _private_ result, which starts out as NULL and is handed
+ *   to every `action` call on that chunk, so actions never share any state. Once every
+ *   chunk is done, the `combine` callback folds each private result into *pp_result* on the
+ *   calling thread, in list order, and then the ending `callback` runs as with `List__for_each`.
+ *   <br />The list must not be changed until the call returns.
+ *
+ * @param p_list The list to iterate.
+ * @param p_pool The worker pool to run on. If NULL, the list is handled as a single chunk on
+ *   the calling thread.
+ * @param pp_result A generic double-pointer used to store the combined result.
+ * @param p_input A generic pointer to some data which is fed into each *action*, *combine*,
+ *   and *callback* call. It is shared by every thread, so actions should only read it.
+ * @param action A per-element operation which accepts the node data, the input data, and
+ *   the chunk's private result double-pointer, respectively. Called from several threads.
+ * @param combine An operation which merges one chunk's private result into the final one.
+ *   This accepts the private result, the input data, and *pp_result* respectively, and is
+ *   responsible for freeing the private result if needed. Chunks with a NULL private result
+ *   are still combined. If NULL, private results are discarded.
+ * @param callback A final, summary operation called after all chunks are combined.
+ *   This accepts the input data and the result double-pointer as parameters respectively.
+ * @return Nothing. The combined result is stored in the given pointer reference *pp_result*.
+ *
+ * @see List__for_each
+ * @see List__thread_pool_new
+ */
+void List__for_each_parallel(
+    List_t* p_list,
+    ListThreadPool_t* p_pool,
+    void**  pp_result,
+    void*   p_input,
+    void    (*action)(void*, void*, void**),
+    void    (*combine)(void*, void*, void**),
+    void    (*callback)(void*, void**)
+);
+
+/**
+ * Start a pool of worker threads for parallel list operations. The pool does not belong to
+ *   any particular list and can be shared by many lists over its lifetime.
+ *
+ * @param nthreads The amount of worker threads to start. The calling thread of a job also
+ *   helps with it, so a job can use up to nthreads+1 threads at once.
+ * @return A pointer to the new pool. NULL if the pool or any of its threads could not be
+ *   created.
+ */
+ListThreadPool_t* List__thread_pool_new( size_t nthreads );
+
+/**
+ * Stop and join every thread in a worker pool and release the pool. It must not be running
+ *   a job at the time.
+ *
+ * @param pp_pool Double-pointer to the pool to delete. Set to NULL afterward.
+ * @return Nothing.
+ */
+void List__thread_pool_delete( ListThreadPool_t** pp_pool );
+
+
+
+/**
+ * Create a cursor positioned on the first element (HEAD) of a linked list. If the list is
+ *   empty, the cursor starts at the end of the list.
+ *
+ * @param p_list The list to walk.
+ * @return A cursor at index 0 of the list.
+ */
+ListCursor_t List__cursor_begin( List_t* p_list );
+
+/**
+ * Advance a cursor to the next element of its list.
+ *
+ * @param p_cursor The cursor to advance.
+ * @return _true_ if the cursor is now on an element, _false_ if it has reached the end.
+ */
+bool List__cursor_next( ListCursor_t* p_cursor );
+
+/**
+ * Check whether a cursor has walked past the final element of its list.
+ *
+ * @param p_cursor The cursor to check.
+ * @return _true_ if the cursor is at the end of its list (or is invalid), _false_ if it
+ *   is on an element.
+ */
+bool List__cursor_at_end( const ListCursor_t* p_cursor );
+
+/**
+ * Get the data pointer of the element under a cursor.
+ *
+ * @param p_cursor The target cursor.
+ * @return The data pointer at the cursor position. _NULL_ if the cursor is at the end.
+ */
+void* List__cursor_get( const ListCursor_t* p_cursor );
+
+/**
+ * Change the data pointer of the element under a cursor.
+ *
+ * @param p_cursor The target cursor.
+ * @param p_new_data The new data pointer for the element.
+ * @return The previous data pointer of the element. _NULL_ if the cursor is at the end.
+ */
+void* List__cursor_set( ListCursor_t* p_cursor, void* p_new_data );
+
+/**
+ * Insert a new element just before the cursor position. The cursor stays on the same
+ *   element, whose index grows by one. Inserting before a cursor at the end of a list
+ *   appends onto the list's tail.
+ *
+ * @param p_cursor The target cursor.
+ * @param p_data The data pointer to insert.
+ * @return _-1_ on failure (such as an out-of-bounds error), or the index of the new element.
+ */
+int List__cursor_insert_before( ListCursor_t* p_cursor, void* p_data );
+
+/**
+ * Insert a new element just after the element under a cursor. The cursor stays where it
+ *   is, so the new element is the next one visited by `List__cursor_next`.
+ *
+ * @param p_cursor The target cursor.
+ * @param p_data The data pointer to insert.
+ * @return _-1_ on failure (such as an out-of-bounds error or a cursor at the end of its
+ *   list), or the index of the new element.
+ */
+int List__cursor_insert_after( ListCursor_t* p_cursor, void* p_data );
+
+/**
+ * Remove the element under a cursor from its list. The cursor moves onto the following
+ *   element, which takes over the removed element's index.
+ *
+ * @param p_cursor The target cursor.
+ * @return The data pointer of the removed element. _NULL_ if the cursor is at the end.
+ */
+void* List__cursor_remove( ListCursor_t* p_cursor );
+
+
+
+/**
+ * Get a view of a range of a linked list without copying it. Like `List__slice`, the
+ *   two indices are _inclusive_, but a view may also hold a single element.
+ *
+ * @param p_list The list to view.
+ * @param from_index The index of the first viewed element.
+ * @param to_index The index of the last viewed element.
+ * @return A view of the range. An empty view (of length _0_) if the range is invalid.
+ */
+ListView_t List__slice_view( List_t* p_list, size_t from_index, size_t to_index );
+
+/**
+ * Get the amount of elements in a view.
+ *
+ * @param p_view The target view.
+ * @return The length of the view.
+ */
+size_t List__view_length( const ListView_t* p_view );
+
+/**
+ * Get a data pointer from a view. The view is walked from its start, so reading a
+ *   view in order should go through `List__view_begin` or `List__view_for_each`.
+ *
+ * @param p_view The target view.
+ * @param index The 0-based index _within the view_ of the element to get.
+ * @return The element's data pointer. _NULL_ if the index is past the end of the view.
+ */
+void* List__view_get_at( const ListView_t* p_view, size_t index );
+
+/**
+ * Get a cursor on the first element of a view, for iterating it. The cursor belongs to
+ *   the viewed list and knows nothing of the view's end, which `List__view_at_end` tests.
+ *
+ * @param p_view The view to iterate.
+ * @return A cursor on the view's first element.
+ */
+ListCursor_t List__view_begin( const ListView_t* p_view );
+
+/**
+ * Tell whether a cursor from `List__view_begin` has stepped past the end of its view.
+ *
+ * @param p_view The view being iterated.
+ * @param p_cursor The iterating cursor.
+ * @return Whether the cursor is outside of the view.
+ */
+bool List__view_at_end( const ListView_t* p_view, const ListCursor_t* p_cursor );
+
+/**
+ * Iterate the elements of a view, exactly like `List__for_each` does for a whole list.
+ *
+ * @param p_view The view to iterate.
+ * @param pp_result A generic double-pointer used to store the result of the iteration(s).
+ * @param p_input A generic pointer to some data which is fed into each *action* call, as
+ *   well as the callback function.
+ * @param action A per-element operation which accepts the node data, the input data, and
+ *   the result double-pointer, respectively.
+ * @param callback A final, summary operation called after all iterations have finished.
+ * @return Nothing. Results are stored through *pp_result*.
+ * @see List__for_each
+ */
+void List__view_for_each(
+    const ListView_t* p_view,
+    void**  pp_result,
+    void*   p_input,
+    void    (*action)(void*, void*, void**),
+    void    (*callback)(void*, void**)
+);
+
+/**
+ * Copy the elements of a view into a new array, exactly like `List__to_array` does
+ *   for a whole list.
+ *
+ * @param p_view The view to convert.
+ * @param element_size The size of each element in the view.
+ * @param extra_bytes Extra (zeroed) bytes to allocate at the end of the array.
+ * @return A pointer to the new array, allocated with the viewed list's allocator. _NULL_
+ *   on failure, for an empty view, or if any viewed element is _NULL_.
+ * @see List__to_array
+ */
+void* List__view_to_array( const ListView_t* p_view, size_t element_size, size_t extra_bytes );
+
 
 
 #endif   /* YALLIC_H */
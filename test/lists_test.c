@@ -12,6 +12,7 @@
 #include <time.h>
 #include <stdio.h>
 #include <signal.h>
+#include <sched.h>
 
 
 
@@ -27,8 +28,21 @@ Test(dummytests, dummyequal) {
 
 static void* dummy_alloc(void) {  return calloc( 1, 1 );  }
 
+static int __compare_ints( const void* p_a, const void* p_b ) {
+    int a = *((const int*)p_a), b = *((const int*)p_b);
+    return (a > b) - (a < b);
+}
+
+// The flags given to the lists which the current test builds for itself. Tests defined
+//   with TEST_LISTOPS_ANY run once for each node layout.
+static unsigned int __test_list_flags = LIST_FLAGS_NONE;
+
+static List_t* __new_test_list( size_t max_size ) {
+    return List__new_with_flags( max_size, __test_list_flags );
+}
+
 static List_t* __create_and_populate( size_t count ) {
-    List_t* p_test = List__new( count );
+    List_t* p_test = __new_test_list( count );
     srand( (unsigned)time(NULL) );   //eh, don't care if multiple times
 
     for ( size_t i = 0; i < count; i++ ) {
@@ -41,6 +55,99 @@ static List_t* __create_and_populate( size_t count ) {
     return p_test;
 }
 
+// Walk an unrolled list's nodes, checking that none is empty, that the back-links agree,
+//   and that they hold 'count' elements.
+static size_t __unrolled_nodes( List_t* p_list ) {
+    size_t nodes = 0, elements = 0;
+    ListUnrolledNode_t* p_last = NULL;
+
+    for ( ListUnrolledNode_t* p_node = LIST_UNROLLED_HEAD( p_list ); NULL != p_node; p_node = p_node->next ) {
+        if (  0 == p_node->used || p_node->used > LIST_UNROLLED_SLOTS || p_last != p_node->prev  )  return 0;
+        elements += p_node->used;
+        p_last = p_node;
+        nodes++;
+    }
+
+    return (  elements == List__length( p_list ) && p_last == LIST_UNROLLED_TAIL( p_list )  ) ? nodes : 0;
+}
+
+// Step to the next node of either kind of chain.
+static ListNode_t* __next_node( List_t* p_list, ListNode_t* p_node ) {
+    return (p_list->flags & LIST_UNROLLED) ? (ListNode_t*)((ListUnrolledNode_t*)p_node)->next : p_node->next;
+}
+
+// Walk a list's node chain and confirm the cached count, TAIL, and back-pointers agree.
+static bool __links_are_consistent( List_t* p_list ) {
+    if ( p_list->flags & LIST_UNROLLED )
+        return (0 == p_list->count) ? (NULL == p_list->head && NULL == p_list->tail) : (0 != __unrolled_nodes( p_list ));
+
+    size_t count = 0;
+    ListNode_t* p_prev = NULL;
+
+    for ( ListNode_t* p_node = p_list->head; NULL != p_node; p_node = p_node->next ) {
+        if (  (p_list->flags & LIST_DOUBLY_LINKED) && p_prev != LIST_NODE_PREV( p_node )  )
+            return false;
+
+        p_prev = p_node;
+        count++;
+    }
+
+    if (  count != p_list->count || p_prev != p_list->tail  )
+        return false;
+
+    // Every slot of an up-to-date pointer hash should count its pointer's occurrences, and
+    //   the node it remembers should be the first one.
+    if (  NULL != p_list->p_hash && !p_list->p_hash->dirty  ) {
+        size_t total = 0, used = 0;
+
+        for ( size_t x = 0; x < p_list->p_hash->capacity; x++ ) {
+            ListHashEntry_t* p_entry = &(p_list->p_hash->slots[x]);
+            if ( NULL == p_entry->key )  continue;
+
+            ListNode_t* p_first = NULL;
+            size_t occurrences = 0;
+            for ( ListNode_t* p_node = p_list->head; NULL != p_node; p_node = p_node->next ) {
+                if ( p_node->data != p_entry->key )  continue;
+                if ( NULL == p_first )  p_first = p_node;
+                occurrences++;
+            }
+
+            if (  occurrences != p_entry->count || (NULL != p_entry->node && p_first != p_entry->node)  )
+                return false;
+
+            total += occurrences;
+            used++;
+        }
+
+        for ( ListNode_t* p_node = p_list->head; NULL != p_node; p_node = p_node->next )
+            if ( NULL == p_node->data )  total++;
+
+        if (  total != p_list->count || used != p_list->p_hash->used  )
+            return false;
+    }
+
+    // Every express lane of an up-to-date skip index should land where its spans say.
+    if (  NULL == p_list->p_index || p_list->p_index->dirty  )
+        return true;
+
+    for ( size_t level = 0; level < p_list->p_index->levels; level++ ) {
+        ListNode_t* p_from = NULL;
+        ListSkipLane_t* p_lane = &(p_list->p_index->head[level]);
+
+        while ( NULL != p_lane->next ) {
+            ListNode_t* p_node = (NULL == p_from) ? p_list->head : p_from->next;
+            for ( size_t x = 1; x < p_lane->span && NULL != p_node; x++ )
+                p_node = p_node->next;
+            if ( p_node != p_lane->next )  return false;
+
+            p_from = p_lane->next;
+            p_lane = &(LIST_NODE_TOWER( p_list, p_from )->lanes[level]);
+        }
+    }
+
+    return true;
+}
+
 #define TEST_SETUP \
     List_t* p_test = __create_and_populate( 100 ); \
     cr_expect(  100 == List__length( p_test ), "List should be populated"  ); \
@@ -65,23 +172,41 @@ static List_t* __create_and_populate( size_t count ) {
 static void lists_setup(void) {  }
 static void lists_teardown(void) {  }
 TestSuite( listops, .init = lists_setup, .fini = lists_teardown );
+TestSuite( listops_unrolled, .init = lists_setup, .fini = lists_teardown );
 
 #define TEST_LISTOPS( name, ... ) \
 Test( listops, name ) { \
+    __test_list_flags = LIST_FLAGS_NONE; \
+    TEST_SETUP \
+    __VA_ARGS__ \
+    TEST_TEARDOWN \
+}
+
+// Tests which only go through the public API run against both regular and unrolled lists.
+#define TEST_LISTOPS_ANY( name, ... ) \
+static void __listops_##name( void ) { \
     TEST_SETUP \
     __VA_ARGS__ \
     TEST_TEARDOWN \
+} \
+Test( listops, name ) { \
+    __test_list_flags = LIST_FLAGS_NONE; \
+    __listops_##name(); \
+} \
+Test( listops_unrolled, name ) { \
+    __test_list_flags = LIST_UNROLLED; \
+    __listops_##name(); \
 }
 
 
 
-TEST_LISTOPS( merge,
+TEST_LISTOPS_ANY( merge,
     // ^ Extend wrapper
     List__pop( p_t1 );
     List__pop( p_t1 );
     cr_assert(  98 == List__length( p_t1 ), "List t1 should be length 98"  );
 
-    List_t* p_t2a = List__new( 2 );
+    List_t* p_t2a = __new_test_list( 2 );
     void* d1 = dummy_alloc();
     void* d2 = dummy_alloc();
     List__push( p_t2a, d2 );
@@ -97,14 +222,14 @@ TEST_LISTOPS( merge,
     List__delete_deep( &p_t2a );
 );
 
-TEST_LISTOPS( merge_at,
+TEST_LISTOPS_ANY( merge_at,
     // ^ Extend-At wrapper
     size_t count = 40;
 
     int* p[count];
     int  i[count];
 
-    List_t* p_src = List__new( count );
+    List_t* p_src = __new_test_list( count );
     for ( size_t x = 0; x < count; x++ ) {
         p[x] = (int*)calloc( 1, sizeof(int) );
         i[x] = (rand() % 200) + 1;
@@ -119,7 +244,7 @@ TEST_LISTOPS( merge_at,
 
 
     // Brief aside to test extend-at
-    List_t* p_dummy = List__new( 0 );
+    List_t* p_dummy = __new_test_list( 0 );
     for ( size_t x = 1; x < 6; x++ )
         List__add( p_dummy, (void*)x );
 
@@ -155,11 +280,11 @@ TEST_LISTOPS( merge_at,
     List__delete_shallow( &p_src );
 );
 
-TEST_LISTOPS( extend_at_head_or_tail,
-    List_t* p_new = List__new( 0 );
-    List_t* p_new_tail = List__new( 0 );
+TEST_LISTOPS_ANY( extend_at_head_or_tail,
+    List_t* p_new = __new_test_list( 0 );
+    List_t* p_new_tail = __new_test_list( 0 );
 
-    List_t* p_localtest = List__new( 100 );
+    List_t* p_localtest = __new_test_list( 100 );
     for ( size_t x = 0; x < 100; x++ ) {
         int* p_i = (int*)calloc( 1, sizeof(int) );
         *p_i = (rand() % 10000) + 1;
@@ -204,9 +329,9 @@ TEST_LISTOPS( extend_at_head_or_tail,
     List__delete_deep( &p_new );
 );
 
-TEST_LISTOPS( extend_at_empty_dest,
-    List_t* p_new    = List__new( 0 );
-    List_t* p_new_at = List__new( 0 );
+TEST_LISTOPS_ANY( extend_at_empty_dest,
+    List_t* p_new    = __new_test_list( 0 );
+    List_t* p_new_at = __new_test_list( 0 );
 
     free(  List__pop( p_test )  );
     void* d1 = dummy_alloc();
@@ -227,7 +352,7 @@ TEST_LISTOPS( extend_at_empty_dest,
     List__delete_shallow( &p_new_at );
 );
 
-TEST_LISTOPS( clear_deep,
+TEST_LISTOPS_ANY( clear_deep,
     for ( size_t x = 0; x < 10; x++ )  List__remove_last( p_test );
     cr_assert(  90 == List__length( p_test ), "List should be trimmed by 10 elements"  );
 
@@ -238,7 +363,7 @@ TEST_LISTOPS( clear_deep,
     cr_assert(  0 == List__length( p_test ), "List clear_deep should empty the list"  );
 );
 
-TEST_LISTOPS( remove_last_to_end,
+TEST_LISTOPS_ANY( remove_last_to_end,
     for ( size_t x = 0; x < 100; x++ )  free(  List__remove_last( p_test )  );
 
     cr_assert(  0 == List__length( p_test ),
@@ -249,7 +374,7 @@ TEST_LISTOPS( remove_last_to_end,
     cr_assert(  d1 == List__get_last( p_test ), "Last item should be '%p' (dummy)", d1  );
 );
 
-TEST_LISTOPS( pop,
+TEST_LISTOPS_ANY( pop,
     free(  List__pop( p_test )  );
     cr_assert(  99 == List__length( p_test ), "List pop should remove one element"  );
 
@@ -257,7 +382,7 @@ TEST_LISTOPS( pop,
     cr_assert(  98 == List__length( p_test ), "List remove_first should remove one element"  );
 );
 
-TEST_LISTOPS( add_remove_replace_reverse,
+TEST_LISTOPS_ANY( add_remove_replace_reverse,
     free(  List__pop( p_test )  );
     free(  List__pop( p_test )  );
 
@@ -296,7 +421,7 @@ TEST_LISTOPS( add_remove_replace_reverse,
         "List remove_last should properly remove old items"  );
 );
 
-TEST_LISTOPS( overflow_add,
+TEST_LISTOPS_ANY( overflow_add,
     void* d1 = dummy_alloc();
     int res = List__add( p_test, d1 );
     cr_assert( -1 == res, "Lists should not allow addition beyond their max_size properties" );
@@ -315,7 +440,7 @@ TEST_LISTOPS( overflow_add,
         "Trying to add at an index when at max_size should error"  );
 );
 
-TEST_LISTOPS( overflow_push,
+TEST_LISTOPS_ANY( overflow_push,
     void* d1 = dummy_alloc();
 
     cr_expect(  -1 == List__push( p_test, d1 ),
@@ -324,7 +449,7 @@ TEST_LISTOPS( overflow_push,
     free( d1 );
 );
 
-TEST_LISTOPS( overflow_extend,
+TEST_LISTOPS_ANY( overflow_extend,
     List_t* p_t1a = __create_and_populate( 10 );
     cr_assert(  14 == List__resize( p_t1a, 14 ),
         "Linked list should be resizeable"  );
@@ -342,7 +467,7 @@ TEST_LISTOPS( overflow_extend,
     List__delete_deep( &p_s1a );
 );
 
-TEST_LISTOPS( slice,
+TEST_LISTOPS_ANY( slice,
     void* p[5] = {0};
     for ( size_t x = 0; x < 5; x++ ) {
         p[x] = dummy_alloc();
@@ -362,11 +487,69 @@ TEST_LISTOPS( slice,
             "List elements are not properly ordered"  );
     }
 
-    List__delete_deep( &p_slice );
+    // The slice shares its data pointers with p_test, which is deeply freed on teardown.
+    List__delete_shallow( &p_slice );
+);
+
+static void __sum_elements( void* p_data, void* p_input, void** pp_result ) {
+    *((long*)*pp_result) += *((int*)p_data);
+}
+
+TEST_LISTOPS_ANY( slice_view,
+    ListView_t view = List__slice_view( p_test, 10, 19 );
+    cr_assert(  10 == List__view_length( &view ), "View should hold 10 elements; got '%lu'", List__view_length( &view )  );
+
+    for ( size_t x = 0; x < 10; x++ )
+        cr_assert(  List__get_at( p_test, (x + 10) ) == List__view_get_at( &view, x ), "View element '%lu' differs", x  );
+    cr_assert(  NULL == List__view_get_at( &view, 10 ), "Views should end at their last element"  );
+
+    // Iteration stops at the end of the view, and the cursor can still edit the list.
+    size_t seen = 0;
+    long expected = 0;
+    for ( ListCursor_t c = List__view_begin( &view ); !List__view_at_end( &view, &c ); List__cursor_next( &c ) ) {
+        cr_assert(  List__get_at( p_test, (seen + 10) ) == List__cursor_get( &c ), "Cursor element '%lu' differs", seen  );
+        expected += *((int*)List__cursor_get( &c ));
+        seen++;
+    }
+    cr_assert(  10 == seen, "The view cursor should see 10 elements; saw '%lu'", seen  );
+
+    long sum = 0;
+    void* p_sum = &sum;
+    List__view_for_each( &view, &p_sum, NULL, __sum_elements, NULL );
+    cr_assert(  expected == sum, "View for-each should only visit the view (%ld/%ld)", sum, expected  );
+
+    int* p_arr = (int*)List__view_to_array( &view, sizeof(int), sizeof(int) );
+    cr_assert(  NULL != p_arr, "View conversion to an array failed"  );
+    for ( size_t x = 0; x < 10; x++ )
+        cr_assert(  p_arr[x] == *((int*)List__get_at( p_test, (x + 10) )), "Array element '%lu' differs", x  );
+    cr_assert(  0 == p_arr[10], "Extra bytes should be zeroed"  );
+    free( p_arr );
+
+    // Single elements, the HEAD and the TAIL are fine; bad ranges give empty views.
+    ListView_t one = List__slice_view( p_test, 0, 0 );
+    ListView_t last = List__slice_view( p_test, 99, 99 );
+    cr_assert(  1 == List__view_length( &one ) && List__get_first( p_test ) == List__view_get_at( &one, 0 ), "HEAD view failed"  );
+    cr_assert(  1 == List__view_length( &last ) && List__get_last( p_test ) == List__view_get_at( &last, 0 ), "TAIL view failed"  );
+
+    ListView_t bad = List__slice_view( p_test, 5, 100 );
+    ListView_t backwards = List__slice_view( p_test, 5, 4 );
+    cr_assert(  0 == List__view_length( &bad ) && 0 == List__view_length( &backwards ), "Bad ranges should give empty views"  );
+    ListCursor_t c = List__view_begin( &bad );
+    cr_assert(  List__view_at_end( &bad, &c ) && NULL == List__view_get_at( &bad, 0 )
+        && NULL == List__view_to_array( &bad, sizeof(int), 0 ), "Empty views hold nothing"  );
+
+    // Indexed lists seek within a view through their skip index.
+    List_t* p_idx = List__new_with_flags( 0, LIST_INDEXED );
+    for ( size_t x = 0; x < 100; x++ )
+        List__add(  p_idx, List__get_at( p_test, x )  );
+    ListView_t idx_view = List__slice_view( p_idx, 50, 89 );
+    for ( size_t x = 0; x < 40; x++ )
+        cr_assert(  List__get_at( p_test, (x + 50) ) == List__view_get_at( &idx_view, x ), "Indexed view element '%lu' differs", x  );
+    List__delete_shallow( &p_idx );
 );
 
-TEST_LISTOPS( deep_copy_and_clone,
-    List_t* p1 = List__new( 5 );
+TEST_LISTOPS_ANY( deep_copy_and_clone,
+    List_t* p1 = __new_test_list( 5 );
 
     int* p[5] = {0};
     int i[5]  = {0};
@@ -411,7 +594,43 @@ TEST_LISTOPS( deep_copy_and_clone,
     List__delete_deep( &p1_clone );
 );
 
-TEST_LISTOPS( set_at,
+TEST_LISTOPS_ANY( deep_copy_contiguous,
+    List__resize( p_test, 101 );
+    List__add( p_test, NULL );
+
+    List_t* p_copy = List__copy_contiguous( p_test, sizeof(int) );
+    cr_assert(  101 == List__length( p_copy ), "The list should be copied"  );
+
+    // Elements are separate but equal, laid out in list order, and so are the nodes.
+    for ( size_t x = 0; x < 100; x++ ) {
+        int* p_original = (int*)List__get_at( p_test, x );
+        int* p_element = (int*)List__get_at( p_copy, x );
+        cr_assert(  p_original != p_element && *p_original == *p_element,
+            "Element '%lu' should be an independent copy", x  );
+        cr_assert(  (void*)p_element == (void*)(p_copy->p_block + (x * sizeof(int))), "Elements should be in list order"  );
+    }
+    cr_assert(  NULL == List__get_last( p_copy ), "NULL elements should stay NULL"  );
+
+    if ( p_copy->flags & LIST_UNROLLED ) {
+        cr_assert(  ((101 + LIST_UNROLLED_SLOTS - 1) / LIST_UNROLLED_SLOTS) == __unrolled_nodes( p_copy ),
+            "Unrolled copies should fill their nodes"  );
+    } else {
+        ListNode_t* p_node = p_copy->head;
+        for ( size_t x = 0; x < 100; x++, p_node = p_node->next )
+            cr_assert(  (char*)p_node->next == ((char*)p_node) + p_copy->pool.node_size, "Nodes should be in list order"  );
+    }
+
+    // Elements added afterward still belong to the caller, and deep deletes free both kinds.
+    List__resize( p_copy, 102 );
+    cr_assert(  102 == List__add( p_copy, calloc( 1, sizeof(int) ) ), "Copies should accept new elements"  );
+    List__delete_deep( &p_copy );
+    cr_assert(  NULL == p_copy, "The copy should be deleted"  );
+
+    cr_assert(  NULL == List__copy_contiguous( p_test, 0 ), "Elements must have a size"  );
+    free( List__remove_last( p_test ) );
+);
+
+TEST_LISTOPS_ANY( set_at,
     void* d1 = dummy_alloc();
     free(  List__set_at( p_test, 45, d1 )  );
 
@@ -419,7 +638,7 @@ TEST_LISTOPS( set_at,
         "List set-at should modify the underlying data pointer"  );
 );
 
-TEST_LISTOPS( remove_at,
+TEST_LISTOPS_ANY( remove_at,
     void* d1 = dummy_alloc();
 
     free(  List__set_at( p_test, 46, d1 )  );
@@ -430,7 +649,7 @@ TEST_LISTOPS( remove_at,
         "List remove-at should properly squash the list"  );
 );
 
-TEST_LISTOPS( add_at,
+TEST_LISTOPS_ANY( add_at,
     void* d1 = dummy_alloc();
 
     free(  List__pop( p_test )  );
@@ -442,7 +661,7 @@ TEST_LISTOPS( add_at,
         "List data pointer at index 27 should match"  );
 );
 
-TEST_LISTOPS( contains,
+TEST_LISTOPS_ANY( contains,
     void* d1 = dummy_alloc();
     void* d2 = dummy_alloc();
     void* d3 = dummy_alloc();
@@ -460,231 +679,1914 @@ TEST_LISTOPS( contains,
     free( d3 );
 );
 
-TEST_LISTOPS( get_max_and_resize,
-    cr_assert(  100 == List__get_max_size( p_test ), "Improper max size"  );
+TEST_LISTOPS_ANY( length_and_tail_tracking,
+    void* d1 = dummy_alloc();
+    void* d2 = dummy_alloc();
 
-    for ( size_t x = 0; x < 15; x++ )
-        free(  List__pop( p_test )  );
-    cr_assert(  100 == List__get_max_size( p_test ), "Improper max size after list size change"  );
+    for ( size_t x = 0; x < 10; x++ )
+        free(  List__remove_at( p_test, 40 )  );
+    cr_assert(  90 == List__length( p_test ), "List remove_at should shrink the count"  );
 
-    cr_assert(  0 == List__resize( p_test, 5 ),
-        "List should not be resizeable below its element count"  );
+    cr_assert(  -1 != List__add_at( p_test, d1, 90 ), "List add_at on the tail should work"  );
+    cr_assert(  d1 == List__get_last( p_test ), "List add_at on the tail should set the tail"  );
 
-    cr_assert(  0 != List__resize( p_test, 553 ),
-        "List should be resizeable within element constraints"  );
-    cr_assert(  553 == List__get_max_size( p_test ),
-        "List max size should match the most recent resize"  );
+    free(  List__remove_last( p_test )  );
+    cr_assert(  90 == List__count( p_test ), "List remove_last should shrink the count"  );
+
+    List_t* p_self = __new_test_list( 0 );
+    List__add( p_self, d1 );
+    List__add( p_self, d2 );
+    cr_assert(  4 == List__extend( p_self, p_self ), "Lists should be able to extend themselves"  );
+    cr_assert(  d2 == List__get_last( p_self ) && d1 == List__get_at( p_self, 2 ),
+        "Self-extension should repeat the list exactly once"  );
+
+    while ( List__length( p_self ) > 0 )  List__pop( p_self );
+    cr_assert(  NULL == List__get_last( p_self ) && 0 == List__size( p_self ),
+        "Popping every node should reset the tail"  );
+
+    cr_assert(  1 == List__add( p_self, d2 ) && d2 == List__get_last( p_self ),
+        "Adding onto a drained list should set both head and tail"  );
+    List__delete_shallow( &p_self );
+    free( d2 );
+);
 
-    List_t* p_new = List__new( 0 );
-    cr_assert(  0xFFFFFFFFFFFFFFFF == List__get_max_size( p_new ),
-        "Improper max size for unbounded list; got '%lu'", List__get_max_size( p_new )  );
-    List__delete_deep( &p_new );
+TEST_LISTOPS( node_pool_reuse_and_shrink,
+    // Nodes released by a pop are handed straight back out by the next push.
+    ListNode_t* p_old_head = p_test->head;
+    void* p_data = List__pop( p_test );
+    cr_assert(  -1 != List__push( p_test, p_data ), "List should be growable"  );
+    cr_assert(  p_old_head == p_test->head, "Popped nodes should be reused by the node pool"  );
+
+    size_t capacity = List__shrink_to_fit( p_test );
+    cr_assert(  capacity >= 100, "A full list must keep the chunks holding its nodes"  );
+
+    // Clearing keeps the capacity around, so refilling does not grow the pool.
+    List_t* p_ptrs = List__clone( p_test );
+    List__clear_shallow( p_test );
+    cr_assert(  0 == List__length( p_test ), "List should be empty after a shallow clear"  );
+
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  -1 != List__add( p_test, List__get_at( p_ptrs, x ) ), "List should be refillable"  );
+    cr_assert(  capacity == List__shrink_to_fit( p_test ), "Refilling should reuse the kept chunks"  );
+
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  List__get_at( p_ptrs, x ) == List__get_at( p_test, x ),
+            "Refilled list should match its old contents at '%lu'", x  );
+
+    // Once the list is drained, shrinking hands everything back.
+    List__clear_shallow( p_test );
+    cr_assert(  0 == List__shrink_to_fit( p_test ), "An empty list should release all node memory"  );
+    cr_assert(  1 == List__add( p_test, List__get_at( p_ptrs, 0 ) ), "A shrunken list should still be usable"  );
+
+    for ( size_t x = 1; x < 100; x++ )
+        List__add( p_test, List__get_at( p_ptrs, x ) );
+    List__delete_shallow( &p_ptrs );
 );
 
+TEST_LISTOPS( compact,
+    // Churn the list so its node order no longer matches its memory order.
+    List__sort( p_test, __compare_ints );
+    for ( size_t x = 0; x < 50; x++ )
+        List__add_at( p_test, List__remove_at( p_test, (x * 7) % 100 ), (x * 13) % 100 );
 
+    void* pp_before[100];
+    for ( size_t x = 0; x < 100; x++ )  pp_before[x] = List__get_at( p_test, x );
 
-// Callback and for-each testing.
-struct __test_iter_t {
-    int was_callbackd;
-};
-struct __test_res_t {
-    size_t add_result;
-    int stored;
-};
-void __test_action( void* p_data, void* p_input, void** pp_result ) {
-    // Add 4 for each element in the test list.
-    if ( NULL != pp_result && NULL != *pp_result ) {
-        ((struct __test_res_t*)(*pp_result))->add_result =
-            ((struct __test_res_t*)(*pp_result))->add_result + 4;
+    cr_assert(  100 == List__compact( p_test ), "Compacting should report the list length"  );
+    cr_assert(  __links_are_consistent( p_test ), "Compacted lists should be linked properly"  );
+    cr_assert(  100 == p_test->pool.capacity && NULL == p_test->pool.chunks->next, "All nodes should share one chunk"  );
+
+    ListNode_t* p_node = p_test->head;
+    for ( size_t x = 0; x < 100; x++, p_node = p_node->next ) {
+        cr_assert(  pp_before[x] == p_node->data, "Element '%lu' should be unchanged", x  );
+        cr_assert(  (char*)p_node == ((char*)p_test->head) + (x * p_test->pool.node_size), "Nodes should be in list order"  );
     }
-}
-void __test_callback( void* p_input, void** pp_result ) {
-    // Set some static numbers to prove a callback can affect out-of-scope variables.
-    if ( NULL != pp_result && NULL != *pp_result )
-        ((struct __test_res_t*)(*pp_result))->stored = 777;
 
-    ((struct __test_iter_t*)p_input)->was_callbackd = 1;
-}
-void __test_action_print( void* p_data, void* p_input, void** pp_result ) {
-    printf( "Node '%d' ==> |%lu|\n", ((struct __test_iter_t*)p_input)->was_callbackd, *((size_t*)p_data) );
-    (((struct __test_iter_t*)p_input)->was_callbackd)++;
+    // Indexed and hashed lists keep working through their stale structures.
+    List_t* p_both = List__new_with_flags( 0, LIST_INDEXED | LIST_HASHED );
+    for ( size_t x = 0; x < 100; x++ )
+        List__add_at( p_both, pp_before[x], x / 2 );
+    List__remove_at( p_both, 10 );
+    void* p_probe = List__get_at( p_both, 42 );
+
+    cr_assert(  99 == List__compact( p_both ), "Indexed and hashed lists should be compacted"  );
+    cr_assert(  p_probe == List__get_at( p_both, 42 ), "Positional access should survive compaction"  );
+    cr_assert(  List__contains( p_both, p_probe ) && 42 == List__index_of( p_both, p_probe ), "Lookups should survive compaction"  );
+    cr_assert(  p_probe == List__remove_first_occurrence( p_both, p_probe ), "Removal should survive compaction"  );
+    cr_assert(  __links_are_consistent( p_both ), "Compacted lists should be linked properly"  );
+    List__delete_shallow( &p_both );
+
+    List_t* p_empty = List__new( 0 );
+    List__add( p_empty, &p_empty );
+    List__pop( p_empty );
+    cr_assert(  0 == List__compact( p_empty ) && 0 == p_empty->pool.capacity, "Empty lists should release their nodes"  );
+    List__delete_shallow( &p_empty );
+);
+
+struct __test_alloc_t {
+    size_t allocs;
+    size_t frees;
+};
+static void* __test_counting_alloc( size_t size, void* p_context ) {
+    ((struct __test_alloc_t*)p_context)->allocs++;
+    return malloc( size );
 }
-void __test_callback_print( void* p_input, void** pp_result ) {
-    printf( "PRINTING COMPLETE (callback)\n" );
+static void __test_counting_free( void* p_ptr, void* p_context ) {
+    if ( NULL != p_ptr )  ((struct __test_alloc_t*)p_context)->frees++;
+    free( p_ptr );
 }
 
+TEST_LISTOPS_ANY( custom_allocator,
+    struct __test_alloc_t counts = {0};
+    ListAllocator_t allocator = {
+        .alloc = __test_counting_alloc,
+        .free = __test_counting_free,
+        .p_context = &counts
+    };
+
+    List_t* p_new = List__new_with_allocator( 0, &allocator );
+    cr_assert(  NULL != p_new && 1 == counts.allocs, "The list structure should come from the allocator"  );
+
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  -1 != List__add( p_new, List__get_at( p_test, x ) ), "List should be growable"  );
+    cr_assert(  counts.allocs > 1, "List nodes should come from the allocator"  );
+
+    // Deep copies, and the lists they produce, also stick to the same allocator.
+    size_t before_copy = counts.allocs;
+    List_t* p_copy = List__copy( p_new, sizeof(int) );
+    cr_assert(  NULL != p_copy && (counts.allocs - before_copy) > 100,
+        "Copied lists and their element copies should come from the allocator"  );
+
+    void* p_arr = List__to_array( p_copy, sizeof(int), 0 );
+    cr_assert(  NULL != p_arr, "List conversion to an array failed"  );
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  ((int*)p_arr)[x] == *((int*)List__get_at( p_test, x )),
+            "Copied values should match at '%lu'", x  );
+    __test_counting_free( p_arr, &counts );
 
-TEST_LISTOPS( foreach_print,
-    List_t* p_localtest = __create_and_populate( 5 );
-
-    struct __test_res_t* p_res =
-        (struct __test_res_t*)calloc( 1, sizeof(struct __test_res_t) );
-    struct __test_iter_t* p_iter =
-        (struct __test_iter_t*)calloc( 1, sizeof(struct __test_iter_t) );
-
-    printf( "FOR-EACH LOOP TESTING...\n" );
-    List__for_each( p_localtest, (void**)&p_res, (void*)p_iter,
-        &__test_action_print, &__test_callback_print );
-
-    p_iter->was_callbackd = 0;
-    List__reverse( &p_localtest );
-    printf( "[REVERSED] FOR-EACH LOOP TESTING...\n" );
-    List__for_each( p_localtest, (void**)&p_res, (void*)p_iter,
-        &__test_action_print, &__test_callback_print );
+    List__delete_shallow( &p_new );
+    List__delete_deep( &p_copy );
+    cr_assert(  counts.allocs == counts.frees,
+        "Everything allocated should be freed (%lu/%lu)", counts.frees, counts.allocs  );
 
-    free( p_iter ); free( p_res );
-    List__delete_deep( &p_localtest );
+    ListAllocator_t broken = { .alloc = NULL, .free = __test_counting_free };
+    cr_assert(  NULL == List__new_with_allocator( 0, &broken ), "Incomplete allocators should be refused"  );
 );
 
-TEST_LISTOPS( foreach_arithmetic,
-    List_t* p_localtest = List__new( 0 );
+TEST_LISTOPS( merge_moves_nodes,
+    struct __test_alloc_t counts = {0};
+    ListAllocator_t allocator = {
+        .alloc = __test_counting_alloc,
+        .free = __test_counting_free,
+        .p_context = &counts
+    };
 
-    int limit = (rand() % 500) + 500;
-    for ( size_t i = 0; i < limit; i++ ) {
-        size_t* p_d = (size_t*)calloc( 1, sizeof(size_t) );
-        cr_expect( -1 != List__add( p_localtest, p_d ), "List should be add-able" );
+    List_t* p_dest = List__new_with_allocator( 0, &allocator );
+    List_t* p_src = List__new_with_allocator( 0, &allocator );
+    for ( size_t x = 0; x < 100; x++ ) {
+        List__add(  p_dest, List__get_at( p_t1, x )  );
+        List__add(  p_src, List__get_at( p_t2, x )  );
     }
 
-    struct __test_res_t* p_res =
-        (struct __test_res_t*)calloc( 1, sizeof(struct __test_res_t) );
-    struct __test_iter_t* p_iter =
-        (struct __test_iter_t*)calloc( 1, sizeof(struct __test_iter_t) );
-
-    List__for_each( p_localtest, (void**)&p_res, (void*)p_iter,
-        &__test_action, &__test_callback );
-
-    cr_expect( (4*List__length( p_localtest )) == p_res->add_result, "The for-each did not iterate properly" );
-    cr_expect( 1 == p_iter->was_callbackd, "The callback for the struct did not issue properly" );
-    cr_expect( 777 == p_res->stored, "Did not see a proper result struct storage" );
+    // Merging hands the source nodes over as they are, without allocating anything.
+    ListNode_t* p_src_head = p_src->head;
+    size_t allocs = counts.allocs;
+    cr_assert(  200 == List__merge_at( p_dest, p_src, 50 ), "Merge-At should move all nodes"  );
+    cr_assert(  allocs == counts.allocs, "Moving nodes should not allocate"  );
+    cr_assert(  0 == List__length( p_src ) && NULL == p_src->pool.chunks, "The source should be left empty"  );
+    cr_assert(  p_src_head == __List__get_node_at( p_dest, 50 ), "The source nodes themselves should be linked in"  );
+    for ( size_t x = 0; x < 200; x++ ) {
+        void* p_want = (x < 50) ? List__get_at( p_t1, x )
+            : (x < 150) ? List__get_at( p_t2, (x - 50) ) : List__get_at( p_t1, (x - 100) );
+        cr_assert(  p_want == List__get_at( p_dest, x ), "Merged element '%lu' is out of place", x  );
+    }
 
-    free( p_res );
-    p_res = (struct __test_res_t*)calloc( 1, sizeof(struct __test_res_t) );
+    // Both lists stay usable: the source grows a fresh pool and the destination keeps adding.
+    cr_assert(  -1 != List__add( p_src, p_t1 ) && -1 != List__add( p_dest, p_t1 ), "Lists should be growable"  );
+    cr_assert(  201 == List__length( p_dest ) && p_t1 == List__get_last( p_dest ), "Destination should grow"  );
+    List__clear_shallow( p_src );
+    cr_assert(  201 == List__merge( p_dest, p_src ), "Merging an empty list should do nothing"  );
 
-    List__for_each( p_localtest, (void**)&p_res,
-        (void*)p_iter, &__test_action, NULL );
+    // Too-small destinations refuse without changing either list.
+    List__add( p_src, p_t1 );
+    List__resize( p_dest, 201 );
+    cr_assert(  -1 == List__merge( p_dest, p_src ), "Out-of-bounds merges should fail"  );
+    cr_assert(  201 == List__length( p_dest ) && 1 == List__length( p_src ), "Failed merges change nothing"  );
 
-    cr_expect( (4*List__length( p_localtest )) == p_res->add_result,
-        "The NULL callback on the for-each did not iterate properly" );
+    List__delete_shallow( &p_dest );
+    List__delete_shallow( &p_src );
+    cr_assert(  counts.allocs == counts.frees,
+        "Everything allocated should be freed once (%lu/%lu)", counts.frees, counts.allocs  );
 
-    free( p_iter ); free( p_res );
-    List__delete_deep( &p_localtest );
-);
+    // Indexed and hashed lists re-index the moved nodes; mismatched layouts fall back to copying.
+    List_t* p_idx = List__new_with_flags( 0, LIST_INDEXED | LIST_HASHED );
+    List_t* p_idx_src = List__new_with_flags( 0, LIST_INDEXED | LIST_HASHED );
+    List_t* p_plain = List__new( 0 );
+    for ( size_t x = 0; x < 100; x++ ) {
+        List__add(  p_idx, List__get_at( p_t1, x )  );
+        List__add(  p_idx_src, List__get_at( p_t2, x )  );
+        List__add(  p_plain, List__get_at( p_test, x )  );
+    }
 
+    cr_assert(  200 == List__merge_at( p_idx, p_idx_src, 0 ), "Indexed merge failed"  );
+    cr_assert(  300 == List__merge_at( p_idx, p_plain, 100 ), "Mixed-layout merge failed"  );
+    cr_assert(  0 == List__length( p_idx_src ) && 0 == List__length( p_plain ), "Sources should be emptied"  );
+    for ( size_t x = 0; x < 100; x++ ) {
+        cr_assert(  List__get_at( p_t2, x ) == List__get_at( p_idx, x ), "Indexed element '%lu' misplaced", x  );
+        cr_assert(  List__get_at( p_test, x ) == List__get_at( p_idx, (x + 100) ), "Copied element '%lu' misplaced", x  );
+        cr_assert(  (x + 200) == (size_t)List__index_of( p_idx, List__get_at( p_t1, x ) ),
+            "Hashed lookups should see moved nodes at '%lu'", x  );
+    }
+    cr_assert(  !List__contains( p_idx_src, List__get_at( p_t2, 0 ) ), "The emptied source should forget its elements"  );
 
+    List__add( p_idx_src, p_t1 );
+    cr_assert(  p_t1 == List__get_at( p_idx_src, 0 ) && List__contains( p_idx_src, p_t1 ), "Emptied sources stay usable"  );
 
-TEST_LISTOPS( list_to_array,
-    for ( size_t x = 0; x < 5; x++ )
-        free(  List__pop( p_test )  );
+    List__delete_shallow( &p_idx );
+    List__delete_shallow( &p_idx_src );
+    List__delete_shallow( &p_plain );
+);
 
-    for ( size_t x = 5; x < 30; x += 5 ) {
-        int* p_x = (int*)calloc( 1, sizeof(int) );
-        *p_x = x;
-        cr_assert(  -1 != List__add_at( p_test, p_x, x ), "List should be growable"  );
+TEST_LISTOPS_ANY( splice_range,
+    List_t* p_dest = __new_test_list( 20 );
+    List_t* p_src = __new_test_list( 0 );
+    for ( size_t x = 0; x < 10; x++ )
+        List__add(  p_dest, List__get_at( p_t1, x )  );
+    for ( size_t x = 0; x < 100; x++ )
+        List__add(  p_src, List__get_at( p_t2, x )  );
+
+    cr_assert(  -1 == List__splice_range( p_dest, 0, p_src, 20, 10 ), "Backwards ranges should fail"  );
+    cr_assert(  -1 == List__splice_range( p_dest, 0, p_src, 90, 100 ), "Ranges past the end should fail"  );
+    cr_assert(  -1 == List__splice_range( p_dest, 11, p_src, 0, 1 ), "Indices past the destination should fail"  );
+    cr_assert(  -1 == List__splice_range( p_dest, 0, p_src, 0, 10 ), "Out-of-bounds moves should fail"  );
+    cr_assert(  -1 == List__splice_range( p_src, 0, p_src, 0, 1 ), "Splicing within one list should fail"  );
+    cr_assert(  10 == List__length( p_dest ) && 100 == List__length( p_src ), "Failures should change nothing"  );
+
+    // Elements [40, 44] land at index 3, keeping their order.
+    cr_assert(  15 == List__splice_range( p_dest, 3, p_src, 40, 44 ), "Range splice failed"  );
+    cr_assert(  95 == List__length( p_src ), "The range should leave the source"  );
+    for ( size_t x = 0; x < 15; x++ ) {
+        void* p_want = (x < 3) ? List__get_at( p_t1, x )
+            : (x < 8) ? List__get_at( p_t2, (x + 37) ) : List__get_at( p_t1, (x - 5) );
+        cr_assert(  p_want == List__get_at( p_dest, x ), "Spliced element '%lu' is out of place", x  );
     }
-    cr_expect(  100 == List__length( p_test ),
-        "List should be 100 elements but got '%lu'", List__length( p_test )  );
-
-    void* p = List__to_array( p_test, sizeof(int), 0 );
-    cr_assert(  NULL != p, "List conversion to an array failed"  );
-
-    for ( size_t x = 5; x < 30; x += 5 ) {
-        int val = *((int*)(p+(x*sizeof(int))));
-        cr_assert(  (int)x == val, "Array value at index '%lu' should "
-            "be '%d' but got '%d'", x, x, val  );
+    for ( size_t x = 0; x < 95; x++ )
+        cr_assert(  List__get_at( p_t2, (x < 40) ? x : (x + 5) ) == List__get_at( p_src, x ),
+            "Remaining source element '%lu' is out of place", x  );
+    cr_assert(  List__get_at( p_t2, 99 ) == List__get_last( p_src ), "Source tail should be kept"  );
+
+    // Ranges at either end of the source, onto either end of the destination.
+    cr_assert(  16 == List__splice_range( p_dest, 0, p_src, 0, 0 ), "Head splice failed"  );
+    cr_assert(  18 == List__splice_range( p_dest, 16, p_src, 92, 93 ), "Tail splice failed"  );
+    cr_assert(  List__get_at( p_t2, 0 ) == List__get_first( p_dest ), "Source head should be first"  );
+    cr_assert(  List__get_at( p_t2, 99 ) == List__get_last( p_dest ), "Source tail should be last"  );
+    cr_assert(  92 == List__length( p_src ) && List__get_at( p_t2, 97 ) == List__get_last( p_src ),
+        "Source tail should follow the removed range"  );
+
+    // The whole of a doubly-linked source moves into a doubly-linked destination.
+    List_t* p_dbl = List__new_with_flags( 0, LIST_DOUBLY_LINKED );
+    List_t* p_dbl_src = List__new_with_flags( 0, LIST_DOUBLY_LINKED );
+    for ( size_t x = 0; x < 10; x++ ) {
+        List__add(  p_dbl, List__get_at( p_t1, x )  );
+        List__add(  p_dbl_src, List__get_at( p_t2, x )  );
+    }
+    cr_assert(  15 == List__splice_range( p_dbl, 5, p_dbl_src, 3, 7 ), "Doubly-linked splice failed"  );
+    cr_assert(  20 == List__splice_range( p_dbl, 15, p_dbl_src, 0, 4 ), "Whole-list splice failed"  );
+    cr_assert(  0 == List__length( p_dbl_src ), "The whole source should be moved"  );
+    for ( size_t x = 0; x < 20; x++ ) {
+        void* p_want = (x < 5) ? List__get_at( p_t1, x )
+            : (x < 10) ? List__get_at( p_t2, (x - 2) )
+            : (x < 15) ? List__get_at( p_t1, (x - 5) )
+            : List__get_at( p_t2, (x < 18) ? (x - 15) : (x - 10) );
+        cr_assert(  p_want == List__get_at( p_dbl, x ), "Doubly-linked element '%lu' is out of place", x  );
     }
+    cr_assert(  List__get_at( p_t2, 9 ) == List__remove_last( p_dbl ), "Backward links should be intact"  );
 
-    free( p );
+    List__delete_shallow( &p_dbl );
+    List__delete_shallow( &p_dbl_src );
+    List__delete_shallow( &p_dest );
+    List__delete_shallow( &p_src );
 );
 
-TEST_LISTOPS( array_to_list,
-    void* p_arr = (void*)calloc( 10, sizeof(int) );
+TEST_LISTOPS( copy_on_write,
+    struct __test_alloc_t counts = {0};
+    ListAllocator_t allocator = {
+        .alloc = __test_counting_alloc,
+        .free = __test_counting_free,
+        .p_context = &counts
+    };
+
+    cr_assert(  NULL == List__new_with_flags( 0, LIST_COPY_ON_WRITE | LIST_INDEXED ),
+        "Copy-on-write lists can't be indexed"  );
+
+    List_t* p_src = List__new_with_options( 0, LIST_COPY_ON_WRITE, &allocator );
+    for ( size_t x = 0; x < 100; x++ )
+        List__add(  p_src, List__get_at( p_test, x )  );
+
+    // Cloning costs a List_t (plus the share itself, once) and never touches the nodes.
+    size_t allocs = counts.allocs;
+    List_t* p_c1 = List__clone( p_src );
+    List_t* p_c2 = List__clone( p_src );
+    cr_assert(  NULL != p_c1 && NULL != p_c2 && 3 == (counts.allocs - allocs), "Clones should be O(1)"  );
+    cr_assert(  p_src->head == p_c1->head && p_src->head == p_c2->head, "Clones should share their nodes"  );
+
+    allocs = counts.allocs;
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  List__get_at( p_test, x ) == List__get_at( p_c1, x ), "Clone element '%lu' differs", x  );
+    cr_assert(  99 == List__index_of( p_c2, List__get_last( p_test ) ) && List__contains( p_c2, List__get_first( p_test ) ),
+        "Searching a clone should work"  );
+    cr_assert(  allocs == counts.allocs, "Reading shared lists should not allocate"  );
+
+    // Shared lists don't own the nodes they read, so shrinking either side leaves them be.
+    cr_assert(  0 == List__shrink_to_fit( p_src ) && 0 == List__shrink_to_fit( p_c2 ), "Shared lists have no pooled nodes"  );
+    cr_assert(  p_src->head == p_c2->head && 100 == List__length( p_src ) && 100 == List__length( p_c2 ),
+        "Shrinking should not touch the shared chain"  );
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  List__get_at( p_test, x ) == List__get_at( p_src, x ), "Shrunk source element '%lu' differs", x  );
+
+    // Changing a clone copies its chain once and leaves the others alone.
+    cr_assert(  List__get_at( p_test, 5 ) == List__set_at( p_c1, 5, p_t1 ), "Set-At on a clone failed"  );
+    cr_assert(  p_src->head != p_c1->head && p_t1 == List__get_at( p_c1, 5 ), "The clone should get its own nodes"  );
+    cr_assert(  List__get_at( p_test, 5 ) == List__get_at( p_src, 5 ), "The source should be unchanged"  );
+    cr_assert(  List__get_at( p_test, 5 ) == List__get_at( p_c2, 5 ), "Other clones should be unchanged"  );
+
+    allocs = counts.allocs;
+    List__set_at( p_c1, 6, p_t1 );
+    cr_assert(  allocs == counts.allocs && p_t1 == List__get_at( p_c1, 6 ), "Private chains are only copied once"  );
+    cr_assert(  101 == List__add( p_c1, p_t2 ), "The clone should grow"  );
+
+    // Once the source copies its chain too, the last clone simply takes the shared nodes back.
+    cr_assert(  101 == List__add( p_src, p_t2 ), "Adding to a shared source failed"  );
+    cr_assert(  100 == List__length( p_c2 ) && List__get_last( p_test ) == List__get_last( p_c2 ),
+        "The clone should not see changes to its source"  );
+    ListNode_t* p_c2_second = p_c2->head->next;
+    allocs = counts.allocs;
+    cr_assert(  List__get_at( p_test, 0 ) == List__remove_at( p_c2, 0 ), "Remove-At on the last sharer failed"  );
+    cr_assert(  allocs == counts.allocs && p_c2_second == p_c2->head, "The last sharer should not copy"  );
+
+    // Suffix slices of singly-linked lists are shared too, and popping them keeps them shared.
+    List_t* p_tail = List__slice( p_c2, 89, 98 );
+    List_t* p_mid = List__slice( p_c2, 10, 20 );
+    cr_assert(  NULL != p_tail && 10 == List__length( p_tail ) && p_c2->tail == p_tail->tail, "Suffix slices should share"  );
+    cr_assert(  NULL != p_mid && 11 == List__length( p_mid ) && NULL == p_mid->p_share, "Inner slices should be copied"  );
+    allocs = counts.allocs;
+    for ( size_t x = 90; x < 100; x++ )
+        cr_assert(  List__get_at( p_test, x ) == List__pop( p_tail ), "Popped slice element '%lu' differs", x  );
+    cr_assert(  allocs == counts.allocs && 0 == List__length( p_tail ) && NULL == p_tail->p_share,
+        "Popping a shared slice should not copy, and empty lists should let go of the share"  );
+    cr_assert(  99 == List__length( p_c2 ) && List__get_last( p_test ) == List__get_last( p_c2 ), "Popping a slice should leave its source be"  );
+
+    // Cursors keep their position when the list gets its own nodes under them.
+    List_t* p_c3 = List__clone( p_c2 );
+    ListCursor_t cursor = List__cursor_begin( p_c3 );
+    for ( size_t x = 0; x < 10; x++ )
+        List__cursor_next( &cursor );
+    cr_assert(  List__get_at( p_test, 11 ) == List__cursor_remove( &cursor ), "Cursor removal on a clone failed"  );
+    cr_assert(  List__get_at( p_test, 12 ) == List__cursor_get( &cursor ) && 98 == List__length( p_c3 ),
+        "The cursor should move on within the clone"  );
+    cr_assert(  List__get_at( p_test, 11 ) == List__get_at( p_c2, 10 ), "Cursor edits should not reach the source"  );
 
-    for ( size_t x = 0; x < 10; x++ ) {
-        int* p_x = (int*)(p_arr+(x*sizeof(int)));
-        *p_x = x*10;
-    }
+    // Merging out of a shared list copies its elements and lets go of the share.
+    cr_assert(  -1 != List__merge( p_c1, p_c3 ) && 199 == List__length( p_c1 ) && 0 == List__length( p_c3 ),
+        "Merging a shared list failed"  );
 
-    List_t* p_new = List__from_array( p_arr, sizeof(int), 10, 11 );
-    cr_assert(  10 == List__length( p_new ), "List did not generate properly"  );
+    List__delete_shallow( &p_src );
+    List__delete_shallow( &p_c1 );
+    List__delete_shallow( &p_c2 );
+    List__delete_shallow( &p_c3 );
+    List__delete_shallow( &p_tail );
+    List__delete_shallow( &p_mid );
+    cr_assert(  counts.allocs == counts.frees,
+        "Everything allocated should be freed once (%lu/%lu)", counts.frees, counts.allocs  );
+
+    // Hashed, doubly-linked clones fill their own hash in from the shared nodes.
+    List_t* p_hashed = List__new_with_flags( 0, LIST_HASHED | LIST_COPY_ON_WRITE );
+    for ( size_t x = 0; x < 100; x++ )
+        List__add(  p_hashed, List__get_at( p_test, x )  );
+    List_t* p_hashed_clone = List__clone( p_hashed );
+    cr_assert(  42 == List__index_of( p_hashed_clone, List__get_at( p_test, 42 ) ), "Hashed clone lookups failed"  );
+    cr_assert(  List__get_at( p_test, 42 ) == List__remove_first_occurrence( p_hashed_clone, List__get_at( p_test, 42 ) ),
+        "Hashed clone removal failed"  );
+    cr_assert(  !List__contains( p_hashed_clone, List__get_at( p_test, 42 ) ) && List__contains( p_hashed, List__get_at( p_test, 42 ) ),
+        "Only the clone should lose the element"  );
+    cr_assert(  List__get_at( p_test, 99 ) == List__remove_last( p_hashed ), "Backward links should survive sharing"  );
+    cr_assert(  98 == List__last_index_of( p_hashed_clone, List__get_at( p_test, 99 ) ), "The clone should keep its tail"  );
+
+    List__delete_shallow( &p_hashed );
+    List__delete_shallow( &p_hashed_clone );
+);
 
-    void* p_i = calloc( 1, sizeof(int) );
-    cr_assert(  -1 != List__add( p_new, p_i ), "List did not accept a new element"  );
+TEST_LISTOPS( doubly_linked,
+    List_t* p_dbl = List__new_with_flags( 0, LIST_DOUBLY_LINKED );
+    cr_assert(  NULL != p_dbl, "Doubly-linked lists should be creatable"  );
+    cr_assert(  NULL == List__new_with_flags( 0, 0x80000000 ), "Unknown flags should be refused"  );
 
-    p_i = calloc( 1, sizeof(int) );
-    cr_assert(  -1 == List__add( p_new, p_i ), "List accepted a new element when it shouldn't"  );
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  -1 != List__add( p_dbl, List__get_at( p_test, x ) ), "List should be growable"  );
+    cr_assert(  __links_are_consistent( p_dbl ), "Back-pointers should follow the chain"  );
 
-    for ( size_t x = 0; x < 10; x++ )
-        cr_assert(  (x*10) == *((int*)(List__get_at( p_new, x ))),
-            "List is not organized properly (%lu)", x  );
+    // Both halves of the list should resolve to the same pointers as the singly-linked source.
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  List__get_at( p_test, x ) == List__get_at( p_dbl, x ),
+            "Lookups from either end should agree at '%lu'", x  );
 
-    free( p_i );
-    free( p_arr );
-    List__delete_deep( &p_new );
+    void* d1 = dummy_alloc();
+    List__add_at( p_dbl, d1, 10 );
+    List__add_at( p_dbl, d1, 80 );
+    List__push( p_dbl, d1 );
+    cr_assert(  __links_are_consistent( p_dbl ), "Back-pointers should survive insertions"  );
+
+    cr_assert(  0 == List__index_of( p_dbl, d1 ), "First occurrence should be the HEAD"  );
+    cr_assert(  81 == List__last_index_of( p_dbl, d1 ),
+        "Last occurrence should be found from the tail; got '%d'", List__last_index_of( p_dbl, d1 )  );
+
+    cr_assert(  d1 == List__remove_last_occurrence( p_dbl, d1 ), "Last occurrence should be removable"  );
+    cr_assert(  11 == List__last_index_of( p_dbl, d1 ), "The previous occurrence should now be last"  );
+    cr_assert(  d1 == List__remove_first_occurrence( p_dbl, d1 ), "First occurrence should be removable"  );
+    cr_assert(  d1 == List__remove_at( p_dbl, 10 ), "Middle removal should return the data pointer"  );
+    cr_assert(  -1 == List__index_of( p_dbl, d1 ), "All occurrences should be gone"  );
+    cr_assert(  __links_are_consistent( p_dbl ), "Back-pointers should survive removals"  );
+
+    for ( size_t x = 100; x > 0; x-- ) {
+        cr_assert(  List__get_at( p_test, x-1 ) == List__remove_last( p_dbl ),
+            "Removing from the tail should yield elements in reverse order"  );
+        cr_assert(  __links_are_consistent( p_dbl ), "Back-pointers should survive tail removals"  );
+    }
+    cr_assert(  0 == List__length( p_dbl ) && NULL == List__remove_last( p_dbl ),
+        "Fully drained list should be empty"  );
+
+    List__add( p_dbl, d1 );
+    List_t* p_clone = List__clone( p_dbl );
+    cr_assert(  NULL != p_clone && (p_clone->flags & LIST_DOUBLY_LINKED)
+        && __links_are_consistent( p_clone ), "Clones should keep the doubly-linked layout"  );
+
+    List__delete_shallow( &p_clone );
+    List__delete_deep( &p_dbl );
 );
 
+TEST_LISTOPS_ANY( reverse_range,
+    void* p_orig[100];
+    for ( size_t x = 0; x < 100; x++ )  p_orig[x] = List__get_at( p_test, x );
 
+    List_t* p_before = p_test;
+    ListNode_t* p_old_head = p_test->head;
+    List__reverse( &p_test );
+    cr_assert(  p_before == p_test, "Reversing should happen in place"  );
+    cr_assert(  p_old_head == p_test->tail && __links_are_consistent( p_test ),
+        "Reversing should relink the existing nodes"  );
+
+    // Ranges spanning several unrolled nodes, starting and ending mid-node.
+    cr_assert(  41 == List__reverse_range( p_test, 7, 47 ) && 41 == List__reverse_range( p_test, 7, 47 ),
+        "Long ranges should be reversible"  );
+    cr_assert(  2 == List__reverse_range( p_test, 12, 13 ) && 2 == List__reverse_range( p_test, 12, 13 ),
+        "Two-element ranges should be reversible"  );
+
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  p_orig[99-x] == List__get_at( p_test, x ), "List should be reversed at '%lu'", x  );
+    List__reverse( &p_test );
 
-///////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////
-// SPEED TESTS.
+    cr_assert(  10 == List__reverse_range( p_test, 20, 29 ), "Middle range should be reversible"  );
+    cr_assert(  5 == List__reverse_range( p_test, 0, 4 ), "Leading range should be reversible"  );
+    cr_assert(  3 == List__reverse_range( p_test, 97, 99 ), "Trailing range should be reversible"  );
+    cr_assert(  1 == List__reverse_range( p_test, 50, 50 ), "Single-element range is a no-op"  );
+    cr_assert(  -1 == List__reverse_range( p_test, 5, 4 ), "Backward range should be refused"  );
+    cr_assert(  -1 == List__reverse_range( p_test, 95, 100 ), "Out-of-bounds range should be refused"  );
+    cr_assert(  __links_are_consistent( p_test ), "Range reversal should keep the chain consistent"  );
 
-TestSuite( speed, .disabled = true );
+    for ( size_t x = 0; x < 100; x++ ) {
+        size_t from = x;
+        if ( x < 5 )  from = 4 - x;
+        else if ( x >= 20 && x <= 29 )  from = 49 - x;
+        else if ( x >= 97 )  from = 196 - x;
 
+        cr_assert(  p_orig[from] == List__get_at( p_test, x ),
+            "Range reversal put the wrong element at '%lu'", x  );
+    }
 
+    // Doubly-linked lists also need their back-pointers flipped.
+    List_t* p_dbl = List__new_with_flags( 0, LIST_DOUBLY_LINKED );
+    for ( size_t x = 0; x < 10; x++ )  List__add( p_dbl, p_orig[x] );
 
-static inline List_t* __test__List__clone_forloop( List_t* p_list ) {
-    size_t len = List__length( p_list );
-    if ( NULL == p_list || 0 == len )  return NULL;
+    List__reverse_range( p_dbl, 3, 9 );
+    List__reverse( &p_dbl );
+    cr_assert(  __links_are_consistent( p_dbl ), "Back-pointers should follow a reversal"  );
+    cr_assert(  p_orig[3] == List__get_first( p_dbl ) && p_orig[0] == List__get_last( p_dbl ),
+        "Doubly-linked reversal should be ordered properly"  );
+    cr_assert(  p_orig[0] == List__remove_last( p_dbl ) && p_orig[1] == List__get_last( p_dbl ),
+        "The tail should be walkable backward after a reversal"  );
 
-    List_t* p_new = List__new( p_list->max_size );
+    List__delete_shallow( &p_dbl );
+);
 
-    p_new->head = LIST_NODE_INITIALIZER;
-    p_new->head->data = p_list->head->data;
+TEST_LISTOPS_ANY( cursor,
+    // Filter out every odd value in one pass, doubling up each multiple of ten.
+    List_t* p_nums = __new_test_list( 0 );
+    size_t values[100];
+    for ( size_t x = 0; x < 100; x++ ) {
+        values[x] = x;
+        List__add( p_nums, &values[x] );
+    }
 
-    ListNode_t* p_scroll = p_new->head;
+    ListCursor_t cursor = List__cursor_begin( p_nums );
+    while (  !List__cursor_at_end( &cursor )  ) {
+        size_t value = *((size_t*)List__cursor_get( &cursor ));
 
-    // Construct blank list nodes to start.
-    for ( size_t x = 1; x < len; x++ ) {
-        ListNode_t* p_new_node = LIST_NODE_INITIALIZER;
+        if ( value % 2 ) {
+            cr_assert(  &values[value] == List__cursor_remove( &cursor ), "Removal should return the data"  );
+            continue;
+        }
 
-        p_scroll->next = p_new_node;
-        p_scroll = p_new_node;
+        if ( 0 == (value % 10) )
+            cr_assert(  -1 != List__cursor_insert_before( &cursor, &values[value] ), "Cursor insertion failed"  );
+
+        List__cursor_next( &cursor );
     }
 
-    // Loop again and fill out the data.
-    p_scroll = p_new->head->next;
-    ListNode_t* p_src_scroll = p_list->head->next;
+    cr_assert(  60 == List__length( p_nums ), "Filtered list should have 60 elements; got '%lu'",
+        List__length( p_nums )  );
+    cr_assert(  60 == cursor.index && __links_are_consistent( p_nums ), "Cursor edits should keep the list consistent"  );
 
-    for ( size_t x = 1; x < len; x++ ) {
-        p_scroll->data = p_src_scroll->data;
+    size_t expect = 0, dupes = 0;
+    for ( size_t x = 0; x < 60; x++ ) {
+        size_t value = *((size_t*)List__get_at( p_nums, x ));
+        cr_assert(  expect == value, "Element '%lu' should be '%lu' but got '%lu'", x, expect, value  );
 
-        p_scroll = p_scroll->next;
-        p_src_scroll = p_src_scroll->next;
+        if ( 0 == (value % 10) && 0 == dupes )  dupes++;
+        else { dupes = 0; expect += 2; }
     }
 
-    // Return the new List_t shallow clone.
-    return p_new;
-}
-static inline List_t* __test__List__clone_addcall( List_t* p_list ) {
-    size_t len = List__length( p_list );
-    if ( NULL == p_list || 0 == len )  return NULL;
+    // Inserting after the cursor, swapping data, and appending at the end.
+    cursor = List__cursor_begin( p_nums );
+    cr_assert(  1 == List__cursor_insert_after( &cursor, &values[99] ), "Insert-after should land at index 1"  );
+    cr_assert(  List__cursor_next( &cursor ) && &values[99] == List__cursor_get( &cursor ),
+        "The cursor should visit the element inserted after it"  );
+    cr_assert(  &values[99] == List__cursor_set( &cursor, &values[1] ) && &values[1] == List__get_at( p_nums, 1 ),
+        "Cursor set should swap the element's data"  );
+
+    while (  List__cursor_next( &cursor )  );
+    cr_assert(  -1 == List__cursor_insert_after( &cursor, &values[3] ), "Nothing to insert after at the end"  );
+    cr_assert(  NULL == List__cursor_remove( &cursor ), "Nothing to remove at the end"  );
+    cr_assert(  61 == List__cursor_insert_before( &cursor, &values[3] ) && &values[3] == List__get_last( p_nums ),
+        "Inserting before the end should append"  );
+    cr_assert(  __links_are_consistent( p_nums ), "The list should stay consistent"  );
+
+    // Cursors on doubly-linked lists keep the back-pointers intact.
+    List_t* p_dbl = List__new_with_flags( 3, LIST_DOUBLY_LINKED );
+    cursor = List__cursor_begin( p_dbl );
+    cr_assert(  List__cursor_at_end( &cursor ), "Cursors on empty lists start at the end"  );
+    List__cursor_insert_before( &cursor, &values[2] );
+    List__cursor_insert_before( &cursor, &values[4] );
+    cursor = List__cursor_begin( p_dbl );
+    List__cursor_insert_after( &cursor, &values[3] );
+    cr_assert(  -1 == List__cursor_insert_after( &cursor, &values[5] ), "Cursors must respect max_size"  );
+    List__cursor_remove( &cursor );
+    cr_assert(  &values[3] == List__get_first( p_dbl ) && &values[4] == List__remove_last( p_dbl )
+        && __links_are_consistent( p_dbl ), "Doubly-linked cursor edits should keep back-pointers valid"  );
+
+    List__delete_shallow( &p_dbl );
+    List__delete_shallow( &p_nums );
+);
 
-    List_t* p_new = List__new( p_list->max_size );
-    ListNode_t* p_scroll = p_list->head;
+TEST_LISTOPS( indexed,
+    // Mirror random positional edits on an indexed list into a plain array.
+    void* p_ref[600];
+    size_t len = 0;
 
-    while ( NULL != p_scroll ) {
-        if (  -1 == List__add( p_new, p_scroll->data )  ) {
-            // If something goes wrong, revert the list changes and destroy the clone.
-            List__delete_shallow( &p_new );
-            return NULL;
+    List_t* p_idx = List__new_with_flags( 0, LIST_INDEXED );
+    cr_assert(  NULL != p_idx && NULL != p_idx->p_index, "Indexed lists should be creatable"  );
+    cr_assert(  NULL == p_test->p_index, "Plain lists should carry no index"  );
+
+    for ( size_t x = 0; x < 100; x++ ) {
+        p_ref[len++] = List__get_at( p_test, x );
+        List__add( p_idx, p_ref[len-1] );
+    }
+    cr_assert(  __links_are_consistent( p_idx ), "Appends should keep the index consistent"  );
+
+    srand( 7 );
+    for ( size_t round = 0; round < 2000; round++ ) {
+        size_t at = rand() % (len + 1);
+
+        if (  len < 500 && (rand() % 2)  ) {
+            void* p_data = List__get_at( p_test, rand() % 100 );
+            // Appending through add_at reports the new length instead of the index.
+            int expect = (at == len) ? (int)(len + 1) : (int)at;
+            cr_assert(  expect == List__add_at( p_idx, p_data, at ), "Insertion should land at '%lu'", at  );
+
+            memmove( &p_ref[at+1], &p_ref[at], (len - at) * sizeof(void*) );
+            p_ref[at] = p_data;
+            len++;
+        } else if ( len > 0 ) {
+            at %= len;
+            cr_assert(  p_ref[at] == List__remove_at( p_idx, at ), "Removal at '%lu' returned the wrong data", at  );
+
+            memmove( &p_ref[at], &p_ref[at+1], (len - at - 1) * sizeof(void*) );
+            len--;
         }
 
-        p_scroll = p_scroll->next;
+        if ( 0 == (round % 100) )
+            cr_assert(  __links_are_consistent( p_idx ), "The index should stay consistent on round '%lu'", round  );
     }
 
-    return p_new;
-}
+    cr_assert(  len == List__length( p_idx ) && __links_are_consistent( p_idx ), "Lengths should agree"  );
+    for ( size_t x = 0; x < len; x++ )
+        cr_assert(  p_ref[x] == List__get_at( p_idx, x ), "Lookup at '%lu' disagrees with the reference", x  );
+
+    // Slices find both ends through the index and inherit it.
+    List_t* p_slice = List__slice( p_idx, 10, 19 );
+    cr_assert(  10 == List__length( p_slice ) && NULL != p_slice->p_index, "Slices should keep the index"  );
+    for ( size_t x = 0; x < 10; x++ )
+        cr_assert(  p_ref[10+x] == List__get_at( p_slice, x ), "Slice element '%lu' is wrong", x  );
+    List__delete_shallow( &p_slice );
+
+    // Reversal leaves the index stale until the next positional access rebuilds it.
+    List__reverse( &p_idx );
+    cr_assert(  p_idx->p_index->dirty, "Reversal should invalidate the index"  );
+    cr_assert(  p_ref[len-1] == List__get_at( p_idx, 0 ) && p_ref[len-2] == List__get_at( p_idx, 1 ),
+        "Lookups after a reversal should rebuild the index"  );
+    cr_assert(  !p_idx->p_index->dirty && __links_are_consistent( p_idx ), "The rebuilt index should be consistent"  );
+    List__reverse( &p_idx );
+
+    // Occurrence removals, pushes, pops, and cursor edits all know their positions.
+    void* d1 = dummy_alloc();
+    List__add_at( p_idx, d1, 50 );
+    List__add( p_idx, d1 );
+    List__push( p_idx, p_ref[0] );
+    cr_assert(  p_ref[0] == List__pop( p_idx ), "Pop should undo the push"  );
+    cr_assert(  d1 == List__remove_last_occurrence( p_idx, d1 ) && d1 == List__remove_first_occurrence( p_idx, d1 ),
+        "Occurrences should be removable"  );
+    cr_assert(  !p_idx->p_index->dirty && __links_are_consistent( p_idx ), "Occurrence removals should update the index"  );
+
+    ListCursor_t cursor = List__cursor_begin( p_idx );
+    for ( size_t x = 0; x < 40; x++ )  List__cursor_next( &cursor );
+    List__cursor_insert_before( &cursor, d1 );
+    List__cursor_insert_after( &cursor, d1 );
+    List__cursor_remove( &cursor );
+    cr_assert(  d1 == List__get_at( p_idx, 40 ) && d1 == List__get_at( p_idx, 41 )
+        && p_ref[41] == List__get_at( p_idx, 42 ), "Cursor edits should be positioned properly"  );
+    cr_assert(  !p_idx->p_index->dirty && __links_are_consistent( p_idx ), "Cursor edits should update the index"  );
+
+    // Doubly-linked indexed lists store the tower pointer after the back-pointer.
+    List_t* p_both = List__new_with_flags( 0, LIST_DOUBLY_LINKED | LIST_INDEXED );
+    cr_assert(  -1 != List__extend( p_both, p_idx ), "Both flags should combine"  );
+    cr_assert(  -1 != List__extend_at( p_both, p_test, 7 ), "Indexed lists should be extendable"  );
+    cr_assert(  List__get_at( p_test, 99 ) == List__get_at( p_both, 106 ) && __links_are_consistent( p_both ),
+        "Extensions should keep the index and back-pointers consistent"  );
+    cr_assert(  List__get_at( p_idx, 2 ) == List__get_at( p_both, 2 ) && NULL != List__remove_last( p_both ),
+        "Lookups should agree between indexed lists"  );
+
+    List__clear_shallow( p_both );
+    cr_assert(  0 == p_both->p_index->levels && -1 != List__add( p_both, d1 ) && d1 == List__get_at( p_both, 0 ),
+        "Clearing should drop the index"  );
+
+    List__delete_shallow( &p_both );
+    List__delete_shallow( &p_idx );
+    free( d1 );
+);
+
+TEST_LISTOPS( hashed,
+    List_t* p_set = List__new_with_flags( 0, LIST_HASHED );
+    cr_assert(  NULL != p_set && NULL != p_set->p_hash && (p_set->flags & LIST_DOUBLY_LINKED),
+        "Hashed lists should be creatable and doubly-linked"  );
+
+    for ( size_t x = 0; x < 100; x++ )
+        List__add( p_set, List__get_at( p_test, x ) );
+    cr_assert(  100 == p_set->p_hash->used && __links_are_consistent( p_set ), "Every pointer should be hashed"  );
+
+    void* d1 = dummy_alloc();
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  List__contains( p_set, List__get_at( p_test, x ) ), "Pointer '%lu' should be found", x  );
+    cr_assert(  !List__contains( p_set, d1 ) && -1 == List__index_of( p_set, d1 )
+        && -1 == List__last_index_of( p_set, d1 ), "Absent pointers should not be found"  );
+    cr_assert(  42 == List__index_of( p_set, List__get_at( p_test, 42 ) ), "Indices should still be reported"  );
+
+    // Duplicates keep track of which node is the first occurrence.
+    List__add_at( p_set, d1, 70 );
+    List__add_at( p_set, d1, 30 );
+    List__add( p_set, d1 );
+    List__push( p_set, NULL );
+    cr_assert(  __links_are_consistent( p_set ), "Duplicates should be counted"  );
+    cr_assert(  31 == List__index_of( p_set, d1 ) && 103 == List__last_index_of( p_set, d1 ),
+        "Duplicate occurrences should be found at both ends"  );
+
+    cr_assert(  d1 == List__remove_first_occurrence( p_set, d1 ) && 71 == List__index_of( p_set, d1 ),
+        "Removing the first occurrence should expose the next one"  );
+    cr_assert(  d1 == List__set_at( p_set, 71, List__get_at( p_test, 0 ) ) && __links_are_consistent( p_set ),
+        "Replacing a pointer should move its hash slot"  );
+    cr_assert(  1 == List__index_of( p_set, List__get_at( p_test, 0 ) ), "The replaced pointer should still come first"  );
+
+    List__reverse( &p_set );
+    cr_assert(  __links_are_consistent( p_set ) && 31 == List__index_of( p_set, List__get_at( p_test, 0 ) ),
+        "Reversal should be reflected by the first occurrences"  );
+    List__reverse( &p_set );
+
+    // Removals and cursor edits keep the hash current, down to an empty set.
+    ListCursor_t cursor = List__cursor_begin( p_set );
+    while (  !List__cursor_at_end( &cursor )  ) {
+        if ( cursor.index % 3 )  List__cursor_next( &cursor );
+        else  List__cursor_remove( &cursor );
+    }
+    cr_assert(  __links_are_consistent( p_set ), "Cursor removals should update the hash"  );
+
+    while ( List__length( p_set ) > 0 ) {
+        void* p_data = List__get_at( p_set, List__length( p_set ) / 2 );
+        cr_assert(  p_data == List__remove_first_occurrence( p_set, p_data ), "Set members should be removable"  );
+        cr_assert(  __links_are_consistent( p_set ), "Removals should update the hash"  );
+    }
+    cr_assert(  0 == p_set->p_hash->used && !List__contains( p_set, d1 ), "Drained sets should hash nothing"  );
+
+    // Copies inherit the hash, and clears empty it.
+    List__extend( p_set, p_test );
+    List_t* p_clone = List__clone( p_set );
+    cr_assert(  NULL != p_clone->p_hash && List__contains( p_clone, List__get_at( p_test, 99 ) )
+        && __links_are_consistent( p_clone ), "Clones should be hashed too"  );
+    List__clear_shallow( p_set );
+    cr_assert(  !List__contains( p_set, List__get_at( p_test, 99 ) ), "Clearing should empty the hash"  );
+
+    List__delete_shallow( &p_clone );
+    List__delete_shallow( &p_set );
+    free( d1 );
+);
+
+TEST_LISTOPS_ANY( sort,
+    ListNode_t* p_nodes[100];
+    size_t x = 0;
+    for ( ListNode_t* p_node = p_test->head; NULL != p_node; p_node = __next_node( p_test, p_node ) )
+        p_nodes[x++] = p_node;
+
+    cr_assert(  100 == List__sort( p_test, __compare_ints ), "Sorting should report the list length"  );
+    cr_assert(  __links_are_consistent( p_test ), "Sorting should keep the chain consistent"  );
+    for ( x = 1; x < 100; x++ )
+        cr_assert(  *((int*)List__get_at( p_test, x-1 )) <= *((int*)List__get_at( p_test, x )),
+            "Element '%lu' is out of order", x  );
+
+    // Only the existing nodes should have been relinked.
+    for ( ListNode_t* p_node = p_test->head; NULL != p_node; p_node = __next_node( p_test, p_node ) ) {
+        bool known = false;
+        for ( x = 0; x < 100 && !known; x++ )  known = (p_nodes[x] == p_node);
+        cr_assert(  known, "Sorting should not allocate new nodes"  );
+    }
+
+    cr_assert(  -1 == List__sort( p_test, NULL ) && -1 == List__sort( NULL, __compare_ints ),
+        "Sorting needs a list and a comparator"  );
+
+    // Equal elements keep their order: sort pairs by their first member only.
+    int pairs[300][2];
+    List_t* p_pairs = List__new_with_flags( 0, (__test_list_flags & LIST_UNROLLED) ? LIST_UNROLLED : (LIST_INDEXED | LIST_HASHED) );
+    for ( x = 0; x < 300; x++ ) {
+        pairs[x][0] = (int)((x * 7) % 10);
+        pairs[x][1] = (int)x;
+        List__add( p_pairs, &pairs[x] );
+    }
+
+    List__sort( p_pairs, __compare_ints );
+    cr_assert(  __links_are_consistent( p_pairs ), "Sorting should keep every index consistent"  );
+    for ( x = 1; x < 300; x++ ) {
+        int* p_a = (int*)List__get_at( p_pairs, x-1 );
+        int* p_b = (int*)List__get_at( p_pairs, x );
+        cr_assert(  p_a[0] < p_b[0] || (p_a[0] == p_b[0] && p_a[1] < p_b[1]),
+            "The sort should be stable at '%lu'", x  );
+    }
+    cr_assert(  &pairs[0] == List__get_first( p_pairs ) && 299 == List__index_of( p_pairs, &pairs[297] ),
+        "Ends of the sorted list should be where they belong"  );
+
+    List__delete_shallow( &p_pairs );
+);
+
+TEST_LISTOPS_ANY( sort_parallel,
+    // Enough pairs for several runs, with plenty of equal keys to expose any instability.
+    size_t count = 70001;
+    int (*p_pairs)[2] = calloc( count, sizeof(int[2]) );
+    List_t* p_src = List__new_with_flags( 0, (__test_list_flags & LIST_UNROLLED) ? LIST_UNROLLED : LIST_DOUBLY_LINKED );
+
+    srand( 11 );
+    for ( size_t x = 0; x < count; x++ ) {
+        p_pairs[x][0] = rand() % 1000;
+        p_pairs[x][1] = (int)x;
+        List__add( p_src, &p_pairs[x] );
+    }
+
+    List_t* p_seq = List__clone( p_src );
+    List__sort( p_seq, __compare_ints );
+
+    for ( size_t threads = 1; threads <= 8; threads++ ) {
+        List_t* p_par = List__clone( p_src );
+        cr_assert(  (int)count == List__sort_parallel( p_par, __compare_ints, threads ),
+            "Parallel sorts should report the list length"  );
+        cr_assert(  __links_are_consistent( p_par ), "Parallel sorts should keep the chain consistent"  );
+
+        void** pp_a = List__to_ptr_array( p_seq );
+        void** pp_b = List__to_ptr_array( p_par );
+        cr_assert(  0 == memcmp( pp_a, pp_b, (count * sizeof(void*)) ),
+            "Sorting on '%lu' threads differs from the sequential sort", threads  );
+        free( pp_a );
+        free( pp_b );
+
+        List__delete_shallow( &p_par );
+    }
+
+    cr_assert(  -1 == List__sort_parallel( p_src, NULL, 4 ), "Parallel sorting needs a comparator"  );
+    cr_assert(  100 == List__sort_parallel( p_test, __compare_ints, 4 )
+        && *((int*)List__get_first( p_test )) <= *((int*)List__get_last( p_test )),
+        "Short lists should simply be sorted on the calling thread"  );
+
+    List__delete_shallow( &p_seq );
+    List__delete_shallow( &p_src );
+    free( p_pairs );
+);
+
+static void __sum_action( void* p_data, void* p_input, void** pp_result ) {
+    // Each private result is allocated the first time its chunk needs it.
+    if ( NULL == *pp_result )  *pp_result = calloc( 1, sizeof(long) );
+    *((long*)*pp_result) += *((int*)p_data) * *((int*)p_input);
+}
+
+static void __sum_combine( void* p_partial, void* p_input, void** pp_result ) {
+    if ( NULL == p_partial )  return;
+
+    *((long*)*pp_result) += *((long*)p_partial);
+    free( p_partial );
+}
+
+static void __sum_callback( void* p_input, void** pp_result ) {
+    *((long*)*pp_result) *= -1;
+}
+
+TEST_LISTOPS_ANY( for_each_parallel,
+    int factor = 3;
+    long expect = 0;
+    for ( size_t x = 0; x < 100; x++ )
+        expect -= *((int*)List__get_at( p_test, x )) * factor;
+
+    ListThreadPool_t* p_pool = List__thread_pool_new( 3 );
+    cr_assert(  NULL != p_pool, "Worker pools should start"  );
+
+    // The same pool serves many calls, across lists of any size.
+    for ( size_t round = 0; round < 50; round++ ) {
+        long sum = 0;
+        void* p_sum = &sum;
+        List__for_each_parallel( p_test, p_pool, &p_sum, &factor, __sum_action, __sum_combine, __sum_callback );
+        cr_assert(  expect == sum, "Round '%lu' should sum to '%ld' but got '%ld'", round, expect, sum  );
+    }
+
+    List_t* p_big = __new_test_list( 0 );
+    int* p_values = calloc( 100000, sizeof(int) );
+    long big_expect = 0;
+    for ( size_t x = 0; x < 100000; x++ ) {
+        p_values[x] = (int)(x % 1000);
+        big_expect -= p_values[x] * factor;
+        List__add( p_big, &p_values[x] );
+    }
+
+    long sum = 0;
+    void* p_sum = &sum;
+    List__for_each_parallel( p_big, p_pool, &p_sum, &factor, __sum_action, __sum_combine, __sum_callback );
+    cr_assert(  big_expect == sum, "Large lists should be summed properly"  );
+
+    // Without a pool, the whole list is one chunk on the calling thread.
+    sum = 0;
+    List__for_each_parallel( p_big, NULL, &p_sum, &factor, __sum_action, __sum_combine, __sum_callback );
+    cr_assert(  big_expect == sum, "Pool-less iteration should give the same result"  );
+
+    List_t* p_one = __new_test_list( 0 );
+    List__add( p_one, &factor );
+    sum = 0;
+    List__for_each_parallel( p_one, p_pool, &p_sum, &factor, __sum_action, __sum_combine, __sum_callback );
+    cr_assert(  -9 == sum, "Single-element lists should still be handled"  );
+
+    ListThreadPool_t* p_lonely = List__thread_pool_new( 0 );
+    sum = 0;
+    List__for_each_parallel( p_big, p_lonely, &p_sum, &factor, __sum_action, __sum_combine, __sum_callback );
+    cr_assert(  big_expect == sum, "A pool without workers should run everything on the caller"  );
+
+    List__thread_pool_delete( &p_lonely );
+    List__thread_pool_delete( &p_pool );
+    cr_assert(  NULL == p_pool, "Deleting a pool should clear the pointer"  );
+
+    List__delete_shallow( &p_one );
+    List__delete_shallow( &p_big );
+    free( p_values );
+);
+
+static const size_t __stack_threads = 4;
+static const size_t __stack_per_thread = 20000;
+
+typedef struct {
+    List_t* p_list;
+    char* p_values;
+    size_t first;
+    unsigned char* p_seen;   // Per-thread pop counts, indexed by value.
+    size_t overflows;   // Times the list was seen above its maximum size.
+} __stack_job_t;
+
+static void* __stack_worker( void* p_arg ) {
+    __stack_job_t* p_job = (__stack_job_t*)p_arg;
+    size_t max_size = List__get_max_size( p_job->p_list );
+
+    for ( size_t x = 0; x < __stack_per_thread; x++ ) {
+        // A full stack is drained a bit by this thread before retrying.
+        while ( -1 == List__push( p_job->p_list, &(p_job->p_values[p_job->first + x]) ) ) {
+            char* p_popped = (char*)List__pop( p_job->p_list );
+            if ( NULL != p_popped )
+                p_job->p_seen[p_popped - p_job->p_values]++;
+        }
+
+        if ( List__length( p_job->p_list ) > max_size )
+            p_job->overflows++;
+
+        // Pop about every other push so the recycled nodes get plenty of reuse.
+        if ( x & 1 ) {
+            char* p_popped = (char*)List__pop( p_job->p_list );
+            if ( NULL != p_popped )
+                p_job->p_seen[p_popped - p_job->p_values]++;
+        }
+    }
+
+    return NULL;
+}
+
+TEST_LISTOPS( concurrent_stack,
+    cr_assert(  NULL == List__new_with_flags( 0, LIST_CONCURRENT_STACK | LIST_DOUBLY_LINKED ),
+        "Concurrent stacks should not mix with other flags"  );
+
+    List_t* p_stack = List__new_with_flags( 1000, LIST_CONCURRENT_STACK );
+    cr_assert(  NULL != p_stack, "Concurrent stacks should be created"  );
+
+    // Single-threaded, it's an ordinary bounded stack.
+    int a = 1, b = 2;
+    cr_assert(  1 == List__push( p_stack, &a ) && 2 == List__push( p_stack, &b ), "Pushes should count up"  );
+    cr_assert(  2 == List__length( p_stack ) && List__is_empty( p_stack ), "Length should be tracked"  );
+    cr_assert(  -1 == List__add( p_stack, &a ), "Other operations should be refused"  );
+    cr_assert(  NULL == List__get_at( p_stack, 0 ) && NULL == List__clone( p_stack ), "Other operations should be refused"  );
+    cr_assert(  -1 == List__extend( p_test, p_stack ), "Other operations should be refused"  );
+    cr_assert(  &b == List__pop( p_stack ) && &a == List__remove_first( p_stack ), "Pops should be LIFO"  );
+    cr_assert(  NULL == List__pop( p_stack ) && 0 == List__length( p_stack ), "The stack should be empty"  );
+
+    List__resize( p_stack, 2 );
+    List__push( p_stack, &a );
+    List__push( p_stack, &b );
+    cr_assert(  -1 == List__push( p_stack, &a ), "The maximum size should be enforced"  );
+    List__clear_shallow( p_stack );
+    cr_assert(  0 == List__length( p_stack ) && NULL == List__pop( p_stack ), "Clearing should empty the stack"  );
+    List__resize( p_stack, 1000 );
+
+    // Now hammer it: every value pushed must come back out exactly once.
+    size_t total = __stack_threads * __stack_per_thread;
+    char* p_values = calloc( total, 1 );
+    unsigned char* p_seen = calloc( __stack_threads * total, 1 );
+
+    pthread_t threads[__stack_threads];
+    __stack_job_t jobs[__stack_threads];
+    for ( size_t t = 0; t < __stack_threads; t++ ) {
+        jobs[t] = (__stack_job_t){ p_stack, p_values, t * __stack_per_thread, &p_seen[t * total], 0 };
+        pthread_create( &threads[t], NULL, __stack_worker, &jobs[t] );
+    }
+    for ( size_t t = 0; t < __stack_threads; t++ ) {
+        pthread_join( threads[t], NULL );
+        cr_assert(  0 == jobs[t].overflows, "Thread '%lu' saw the stack grow past its maximum size", t  );
+    }
+
+    cr_assert(  List__length( p_stack ) <= 1000, "The stack should respect its maximum size"  );
+    for ( char* p_popped; NULL != (p_popped = (char*)List__pop( p_stack )); )
+        p_seen[p_popped - p_values]++;
+    cr_assert(  0 == List__length( p_stack ), "Draining should empty the stack"  );
+
+    for ( size_t x = 0; x < total; x++ ) {
+        size_t times = 0;
+        for ( size_t t = 0; t < __stack_threads; t++ )
+            times += p_seen[(t * total) + x];
+        cr_assert(  1 == times, "Value '%lu' was popped '%lu' times", x, times  );
+    }
+
+    free( p_seen );
+    free( p_values );
+    List__delete_shallow( &p_stack );
+);
+
+static const size_t __queue_producers = 3;
+static const size_t __queue_consumers = 3;
+static const size_t __queue_per_producer = 30000;
+
+typedef struct {
+    List_t* p_list;
+    size_t* p_values;   // Value 'x' is (producer * __queue_per_producer) + sequence.
+    size_t producer;   // Producer number, for producers.
+    _Atomic size_t* p_consumed;   // Shared count of dequeued values, for consumers.
+    unsigned char* p_seen;   // Per-consumer dequeue counts, indexed by value.
+    size_t out_of_order;   // Values from one producer seen out of their enqueue order.
+    size_t overflows;   // Times the queue was seen above its maximum size, for producers.
+} __queue_job_t;
+
+static void* __queue_producer( void* p_arg ) {
+    __queue_job_t* p_job = (__queue_job_t*)p_arg;
+
+    size_t max_size = List__get_max_size( p_job->p_list );
+
+    for ( size_t x = 0; x < __queue_per_producer; x++ ) {
+        size_t* p_value = &(p_job->p_values[(p_job->producer * __queue_per_producer) + x]);
+        while ( -1 == List__add( p_job->p_list, p_value ) )
+            sched_yield();
+
+        if ( List__length( p_job->p_list ) > max_size )
+            p_job->overflows++;
+    }
+
+    return NULL;
+}
+
+static void* __queue_consumer( void* p_arg ) {
+    __queue_job_t* p_job = (__queue_job_t*)p_arg;
+    size_t total = __queue_producers * __queue_per_producer;
+    size_t last[__queue_producers];
+    for ( size_t p = 0; p < __queue_producers; p++ )  last[p] = SIZE_MAX;
+
+    while ( atomic_load( p_job->p_consumed ) < total ) {
+        size_t* p_value = (size_t*)List__remove_first( p_job->p_list );
+        if ( NULL == p_value ) {
+            sched_yield();
+            continue;
+        }
+
+        atomic_fetch_add( p_job->p_consumed, 1 );
+        p_job->p_seen[*p_value]++;
+
+        // A single consumer must see each producer's values in the order they were added.
+        size_t producer = *p_value / __queue_per_producer;
+        if (  SIZE_MAX != last[producer] && *p_value < last[producer]  )
+            p_job->out_of_order++;
+        last[producer] = *p_value;
+    }
+
+    return NULL;
+}
+
+TEST_LISTOPS( concurrent_queue,
+    cr_assert(  NULL == List__new_with_flags( 0, LIST_CONCURRENT_QUEUE | LIST_CONCURRENT_STACK ),
+        "Concurrent queues should not mix with other flags"  );
+
+    List_t* p_queue = List__new_with_flags( 500, LIST_CONCURRENT_QUEUE );
+    cr_assert(  NULL != p_queue, "Concurrent queues should be created"  );
+
+    // Single-threaded, it's an ordinary bounded FIFO.
+    int a = 1, b = 2, c = 3;
+    cr_assert(  NULL == List__pop( p_queue ), "New queues should be empty"  );
+    cr_assert(  1 == List__add( p_queue, &a ) && 2 == List__add( p_queue, &b ), "Appends should count up"  );
+    cr_assert(  -1 == List__push( p_queue, &c ), "Pushing onto a queue should be refused"  );
+    cr_assert(  NULL == List__remove_last( p_queue ), "Other operations should be refused"  );
+    cr_assert(  2 == List__length( p_queue ), "Length should be tracked"  );
+    cr_assert(  &a == List__pop( p_queue ), "Queues should be FIFO"  );
+    cr_assert(  2 == List__add( p_queue, &c ), "Appends should count up"  );
+    cr_assert(  &b == List__remove_first( p_queue ) && &c == List__pop( p_queue ), "Queues should be FIFO"  );
+    cr_assert(  NULL == List__pop( p_queue ) && 0 == List__length( p_queue ), "The queue should be empty"  );
+
+    List__resize( p_queue, 2 );
+    List__add( p_queue, &a );
+    List__add( p_queue, &b );
+    cr_assert(  -1 == List__add( p_queue, &c ), "The maximum size should be enforced"  );
+    List__clear_shallow( p_queue );
+    cr_assert(  NULL == List__pop( p_queue ), "Clearing should empty the queue"  );
+    cr_assert(  1 == List__add( p_queue, &a ) && &a == List__pop( p_queue ), "Cleared queues should still work"  );
+
+    // Deep clears free whatever is still queued.
+    for ( size_t x = 0; x < 2; x++ )
+        List__add( p_queue, calloc( 1, sizeof(int) ) );
+    List__clear_deep( p_queue );
+    cr_assert(  0 == List__length( p_queue ), "Deep clears should empty the queue"  );
+    List__resize( p_queue, 500 );
+
+    // Now hammer it from both ends: every value must come out exactly once.
+    size_t total = __queue_producers * __queue_per_producer;
+    size_t* p_values = calloc( total, sizeof(size_t) );
+    for ( size_t x = 0; x < total; x++ )  p_values[x] = x;
+    unsigned char* p_seen = calloc( __queue_consumers * total, 1 );
+    _Atomic size_t consumed = 0;
+
+    pthread_t threads[__queue_producers + __queue_consumers];
+    __queue_job_t jobs[__queue_producers + __queue_consumers];
+    for ( size_t t = 0; t < (__queue_producers + __queue_consumers); t++ ) {
+        bool producer = (t < __queue_producers);
+        jobs[t] = (__queue_job_t){ p_queue, p_values, t, &consumed,
+            producer ? NULL : &p_seen[(t - __queue_producers) * total], 0, 0 };
+        pthread_create( &threads[t], NULL, producer ? __queue_producer : __queue_consumer, &jobs[t] );
+    }
+    for ( size_t t = 0; t < (__queue_producers + __queue_consumers); t++ ) {
+        pthread_join( threads[t], NULL );
+        cr_assert(  0 == jobs[t].out_of_order, "Consumer '%lu' saw values out of order", t  );
+        cr_assert(  0 == jobs[t].overflows, "Producer '%lu' saw the queue grow past its maximum size", t  );
+    }
+
+    cr_assert(  NULL == List__pop( p_queue ) && 0 == List__length( p_queue ), "Every value should be consumed"  );
+    for ( size_t x = 0; x < total; x++ ) {
+        size_t times = 0;
+        for ( size_t t = 0; t < __queue_consumers; t++ )
+            times += p_seen[(t * total) + x];
+        cr_assert(  1 == times, "Value '%lu' was dequeued '%lu' times", x, times  );
+    }
+
+    free( p_seen );
+    free( p_values );
+    List__delete_shallow( &p_queue );
+);
+
+static void* __test_limited_alloc( size_t size, void* p_context ) {
+    size_t* p_allocs_left = (size_t*)p_context;
+    if ( 0 == *p_allocs_left )  return NULL;
+
+    (*p_allocs_left)--;
+    return malloc( size );
+}
+static void __test_limited_free( void* p_ptr, void* p_context ) {
+    free( p_ptr );
+}
+
+TEST_LISTOPS( add_many_and_push_many,
+    int values[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    void* pp_data[10];
+    for ( size_t x = 0; x < 10; x++ )  pp_data[x] = &values[x];
+
+    cr_assert(  -1 == List__add_many( p_test, pp_data, 1 ), "Batches should not exceed the maximum size"  );
+
+    List__resize( p_test, 115 );
+    cr_assert(  110 == List__add_many( p_test, pp_data, 10 ), "Batches should be appended"  );
+    for ( size_t x = 0; x < 10; x++ )
+        cr_assert(  &values[x] == List__get_at( p_test, 100 + x ), "Batches should keep their order"  );
+    cr_assert(  110 == List__add_many( p_test, NULL, 0 ), "Empty batches should change nothing"  );
+    cr_assert(  -1 == List__add_many( p_test, pp_data, 10 ), "Batches should not exceed the maximum size"  );
+    cr_assert(  110 == List__length( p_test ), "Refused batches should add nothing"  );
+
+    // The batch doesn't belong to the heap, so it can't be left to the deep delete.
+    for ( size_t x = 0; x < 100; x++ )  free( List__pop( p_test ) );
+    List__clear_shallow( p_test );
+
+    // Pushed batches read like single pushes: the last element ends up first.
+    cr_assert(  3 == List__push_many( p_test, pp_data, 3 ), "Batches should be pushed"  );
+    cr_assert(  5 == List__push_many( p_test, &pp_data[3], 2 ), "Batches should be pushed"  );
+    int expect_pushed[5] = { 4, 3, 2, 1, 0 };
+    for ( size_t x = 0; x < 5; x++ )
+        cr_assert(  expect_pushed[x] == *((int*)List__get_at( p_test, x )), "Pushed batches should be reversed"  );
+    cr_assert(  __links_are_consistent( p_test ), "Pushed batches should link properly"  );
+    List__clear_shallow( p_test );
+
+    // A list can be spliced into the middle of itself through the same bulk path.
+    List_t* p_self = List__new_with_flags( 0, LIST_DOUBLY_LINKED );
+    List__add_many( p_self, pp_data, 3 );
+    cr_assert(  6 == List__extend_at( p_self, p_self, 1 ), "Lists should extend themselves"  );
+    int expect_self[6] = { 0, 0, 1, 2, 1, 2 };
+    for ( size_t x = 0; x < 6; x++ )
+        cr_assert(  expect_self[x] == *((int*)List__get_at( p_self, x )), "Self-extension should copy the original list"  );
+    cr_assert(  __links_are_consistent( p_self ), "Self-extension should link properly"  );
+    List__delete_shallow( &p_self );
+
+    // Batches bigger than any pool chunk still take a single allocation.
+    struct __test_alloc_t counts = {0};
+    ListAllocator_t counting = { .alloc = __test_counting_alloc, .free = __test_counting_free, .p_context = &counts };
+    List_t* p_big = List__new_with_options( 0, LIST_FLAGS_NONE, &counting );
+    void** pp_big = calloc( 10000, sizeof(void*) );
+    size_t allocs = counts.allocs;
+    cr_assert(  10000 == List__add_many( p_big, pp_big, 10000 ), "Large batches should be added"  );
+    cr_assert(  (allocs + 1) == counts.allocs, "Large batches should allocate their nodes at once"  );
+    free( pp_big );
+    List__delete_shallow( &p_big );
+
+    // Running out of memory halfway through a batch takes the whole batch back off. The
+    //   allocator only has room for the list and the pool's first (32-node) chunk.
+    size_t allocs_left = 2;
+    ListAllocator_t allocator = { .alloc = __test_limited_alloc, .free = __test_limited_free, .p_context = &allocs_left };
+    List_t* p_small = List__new_with_options( 0, LIST_DOUBLY_LINKED, &allocator );
+    List__add( p_small, &values[0] );
+
+    void* pp_many[40];
+    for ( size_t x = 0; x < 40; x++ )  pp_many[x] = &values[x % 10];
+    cr_assert(  -1 == List__add_many( p_small, pp_many, 40 ), "Failed allocations should fail the batch"  );
+    cr_assert(  1 == List__length( p_small ) && p_small->head == p_small->tail, "Failed batches should add nothing"  );
+    cr_assert(  __links_are_consistent( p_small ), "Failed batches should leave consistent links"  );
+    List__delete_shallow( &p_small );
+);
+
+static const size_t __ring_items = 200000;
+
+static void* __ring_producer( void* p_arg ) {
+    List_t* p_ring = (List_t*)p_arg;
+    size_t next = 1;
+
+    while ( next <= __ring_items ) {
+        // Alternate single adds with batches of uneven sizes, to hit the wrap-around.
+        void* pp_batch[7];
+        size_t batch = (next % 3) ? 1 : 7;
+        if ( batch > (__ring_items + 1 - next) )  batch = __ring_items + 1 - next;
+        for ( size_t x = 0; x < batch; x++ )  pp_batch[x] = (void*)(uintptr_t)(next + x);
+
+        if (  -1 == ((1 == batch) ? List__add( p_ring, pp_batch[0] ) : List__add_many( p_ring, pp_batch, batch ))  )
+            sched_yield();
+        else
+            next += batch;
+    }
+
+    return NULL;
+}
+
+TEST_LISTOPS( spsc_ring,
+    cr_assert(  NULL == List__new_with_flags( 0, LIST_SPSC_RING ), "Rings should need a maximum size"  );
+    cr_assert(  NULL == List__new_with_flags( 10, LIST_SPSC_RING | LIST_DOUBLY_LINKED ),
+        "Rings should not mix with other flags"  );
+
+    List_t* p_ring = List__new_with_flags( 5, LIST_SPSC_RING );
+    cr_assert(  NULL != p_ring, "Rings should be created"  );
+
+    // Single-threaded, it's a bounded FIFO whose maximum need not be a power of two.
+    int values[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    void* pp_data[8];
+    for ( size_t x = 0; x < 8; x++ )  pp_data[x] = &values[x];
+
+    cr_assert(  NULL == List__pop( p_ring ) && !List__is_empty( p_ring ), "New rings should be empty"  );
+    cr_assert(  3 == List__add_many( p_ring, pp_data, 3 ), "Batches should be added"  );
+    cr_assert(  -1 == List__add_many( p_ring, pp_data, 3 ), "Rings should keep to their maximum size"  );
+    cr_assert(  5 == List__add_many( p_ring, &pp_data[3], 2 ), "Rings should fill up to their maximum size"  );
+    cr_assert(  -1 == List__add( p_ring, &values[5] ) && 5 == List__length( p_ring ), "Full rings should refuse adds"  );
+    cr_assert(  -1 == List__push( p_ring, &values[5] ) && NULL == List__get_first( p_ring ),
+        "Other operations should be refused"  );
+    cr_assert(  0 == List__pop_many( p_test, pp_data, 1 ), "Lists other than rings should refuse batch pops"  );
+
+    void* pp_out[8];
+    cr_assert(  &values[0] == List__remove_first( p_ring ), "Rings should be FIFO"  );
+    cr_assert(  2 == List__pop_many( p_ring, pp_out, 2 ) && &values[1] == pp_out[0] && &values[2] == pp_out[1],
+        "Batches should be popped in order"  );
+
+    // The next batch wraps around the end of the (8) slots.
+    cr_assert(  5 == List__add_many( p_ring, &pp_data[5], 3 ), "Batches should wrap around"  );
+    cr_assert(  5 == List__pop_many( p_ring, pp_out, 8 ), "Popping should stop at the end of the ring"  );
+    for ( size_t x = 0; x < 5; x++ )
+        cr_assert(  &values[3 + x] == pp_out[x], "Wrapped batches should keep their order"  );
+
+    cr_assert(  0 == List__resize( p_ring, 9 ) && 8 == List__resize( p_ring, 8 ), "Rings should only resize within their slots"  );
+    List__add( p_ring, calloc( 1, sizeof(int) ) );
+    List__clear_deep( p_ring );
+    cr_assert(  0 == List__length( p_ring ) && NULL == List__pop( p_ring ), "Deep clears should empty the ring"  );
+
+    // Now stream through it from another thread: the consumer must see 1..N in order.
+    pthread_t producer;
+    pthread_create( &producer, NULL, __ring_producer, p_ring );
+
+    size_t expect = 1, bad = 0;
+    while ( expect <= __ring_items ) {
+        size_t popped = List__pop_many( p_ring, pp_out, (expect & 1) ? 8 : 1 );
+        if ( 0 == popped )  sched_yield();
+
+        for ( size_t x = 0; x < popped; x++, expect++ )
+            if ( (uintptr_t)pp_out[x] != expect )  bad++;
+    }
+    pthread_join( producer, NULL );
+
+    cr_assert(  0 == bad, "'%lu' values came out of the ring out of order", bad  );
+    cr_assert(  0 == List__length( p_ring ), "The ring should be drained"  );
+
+    List__delete_shallow( &p_ring );
+);
+
+TEST_LISTOPS( finger,
+    unsigned int flag_sets[] = { LIST_FLAGS_NONE, LIST_DOUBLY_LINKED, LIST_INDEXED, LIST_HASHED };
+
+    for ( size_t f = 0; f < (sizeof(flag_sets) / sizeof(flag_sets[0])); f++ ) {
+        List_t* p_list = List__new_with_flags( 0, flag_sets[f] );
+        void* model[400];
+        size_t len = 0;
+        size_t next_id = 1;
+
+        for ( ; len < 100; len++ ) {
+            model[len] = (void*)(next_id++);
+            List__add( p_list, model[len] );
+        }
+
+        // Random edits at positions near and far from the finger must keep it honest.
+        srand( 1234 );
+        for ( size_t round = 0; round < 3000; round++ ) {
+            size_t at = (0 == len) ? 0 : (size_t)rand() % len;
+            switch ( rand() % 7 ) {
+                case 0:
+                    if ( len < 400 ) {
+                        memmove( &model[at + 1], &model[at], (len - at) * sizeof(void*) );
+                        model[at] = (void*)(next_id++);
+                        len++;
+                        cr_assert(  -1 != List__add_at( p_list, model[at], at ), "Add-At failed"  );
+                    }
+                    break;
+                case 1:
+                    if ( len > 0 ) {
+                        cr_assert(  model[at] == List__remove_at( p_list, at ), "Remove-At returned the wrong element"  );
+                        memmove( &model[at], &model[at + 1], (len - at - 1) * sizeof(void*) );
+                        len--;
+                    }
+                    break;
+                case 2:
+                    if ( len > 0 ) {
+                        model[at] = (void*)(next_id++);
+                        List__set_at( p_list, at, model[at] );
+                    }
+                    break;
+                case 3:
+                    if ( len > 0 ) {
+                        cr_assert(  model[0] == List__pop( p_list ), "Pop returned the wrong element"  );
+                        memmove( &model[0], &model[1], (len - 1) * sizeof(void*) );
+                        len--;
+                    }
+                    break;
+                case 4:
+                    if ( len > 1 ) {
+                        size_t to = at + ((size_t)rand() % (len - at));
+                        List__reverse_range( p_list, at, to );
+                        for ( size_t lo = at, hi = to; lo < hi; lo++, hi-- ) {
+                            void* p_swap = model[lo];
+                            model[lo] = model[hi];
+                            model[hi] = p_swap;
+                        }
+                    }
+                    break;
+                case 5:
+                    if ( len < 400 ) {
+                        memmove( &model[1], &model[0], len * sizeof(void*) );
+                        model[0] = (void*)(next_id++);
+                        len++;
+                        List__push( p_list, model[0] );
+                    }
+                    break;
+                default:
+                    for ( size_t x = at; x < len && x < (at + 5); x++ )
+                        cr_assert(  model[x] == List__get_at( p_list, x ), "Nearby element '%lu' differs", x  );
+                    break;
+            }
+
+            cr_assert(  len == List__length( p_list ), "List length should be '%lu'", len  );
+            if ( len > 0 )
+                cr_assert(  model[at % len] == List__get_at( p_list, (at % len) ), "Element '%lu' differs", (at % len)  );
+        }
+
+        for ( size_t x = 0; x < len; x++ )
+            cr_assert(  model[x] == List__get_at( p_list, x ), "Final element '%lu' differs (flags %u)", x, flag_sets[f]  );
+        for ( size_t x = len; x > 0; x-- )
+            cr_assert(  model[x - 1] == List__get_at( p_list, (x - 1) ), "Backward element '%lu' differs", (x - 1)  );
+
+        List__delete_shallow( &p_list );
+    }
+);
+
+TEST_LISTOPS( unrolled,
+    cr_assert(  NULL == List__new_with_flags( 0, (LIST_UNROLLED | LIST_DOUBLY_LINKED) ), "Unrolled lists can't take other flags"  );
+    cr_assert(  NULL == List__new_with_flags( 0, (LIST_UNROLLED | LIST_HASHED) ), "Unrolled lists can't take other flags"  );
+
+    List_t* p_list = List__new_with_flags( 0, LIST_UNROLLED );
+    cr_assert(  NULL != p_list, "Failed to create an unrolled list"  );
+    cr_assert(  NULL == List__get_first( p_list ) && NULL == List__get_last( p_list ) && NULL == List__pop( p_list ), "An empty list has no elements"  );
+
+    // Appending fills each node before starting another.
+    for ( size_t x = 0; x < 1000; x++ )
+        List__add( p_list, (void*)(x + 1) );
+    cr_assert(  ((1000 + LIST_UNROLLED_SLOTS - 1) / LIST_UNROLLED_SLOTS) == __unrolled_nodes( p_list ), "Appended nodes should be full"  );
+    cr_assert(  (void*)1 == List__get_first( p_list ) && (void*)1000 == List__get_last( p_list ), "Wrong ends"  );
+    cr_assert(  499 == List__index_of( p_list, (void*)500 ) && List__contains( p_list, (void*)1000 ), "Search failed"  );
+    cr_assert(  -1 == List__index_of( p_list, (void*)5000 ) && !List__contains( p_list, (void*)5000 ), "Found a missing element"  );
+
+    void** pp_all = List__to_ptr_array( p_list );
+    for ( size_t x = 0; x < 1000; x++ )
+        cr_assert(  (void*)(x + 1) == pp_all[x], "Pointer array element '%lu' differs", x  );
+    free( pp_all );
+
+    // Pushing onto a full HEAD starts a new node in front of the one the finger is on.
+    cr_assert(  (void*)501 == List__get_at( p_list, 500 ), "Element 500 differs"  );
+    List__push( p_list, (void*)5000 );
+    cr_assert(  (void*)501 == List__get_at( p_list, 501 ), "The finger went stale after pushing"  );
+    cr_assert(  (void*)5000 == List__pop( p_list ), "Pop returned the wrong element"  );
+
+    // Emptying the TAIL hands the finger to the node before it, at that node's own index.
+    List_t* p_short = List__new_with_flags( 0, LIST_UNROLLED );
+    size_t short_len = 3 * LIST_UNROLLED_SLOTS;
+    for ( size_t x = 0; x <= short_len; x++ )
+        List__add( p_short, (void*)(x + 1) );
+    cr_assert(  (void*)(short_len + 1) == List__remove_last( p_short ), "Remove-Last returned the wrong element"  );
+    for ( size_t x = short_len; x < (short_len + 30); x++ )
+        List__add( p_short, (void*)(x + 1) );
+    cr_assert(  (void*)(short_len + 2) == List__get_at( p_short, (short_len + 1) ), "The finger went stale after emptying the TAIL"  );
+    List__delete_shallow( &p_short );
+
+    List_t* p_clone = List__clone( p_list );
+    List__reverse( &p_clone );
+    for ( size_t x = 0; x < 1000; x++ )
+        cr_assert(  (void*)(1000 - x) == List__get_at( p_clone, x ), "Reversed clone element '%lu' differs", x  );
+    cr_assert(  0 != __unrolled_nodes( p_clone ), "Reversed clone is malformed"  );
+    List__delete_shallow( &p_clone );
+
+    // Runs of elements are copied between regular and unrolled lists either way.
+    cr_assert(  1100 == List__extend_at( p_list, p_test, 500 ), "Extending by a regular list failed"  );
+    cr_assert(  List__get_at( p_test, 0 ) == List__get_at( p_list, 500 ) && (void*)501 == List__get_at( p_list, 600 ),
+        "The extension is out of place"  );
+    cr_assert(  0 != __unrolled_nodes( p_list ), "Extending malformed the node chain"  );
+
+    List_t* p_plain = List__new( 0 );
+    cr_assert(  100 == List__splice_range( p_plain, 0, p_list, 500, 599 ) && 1000 == List__length( p_list ),
+        "Splicing into a regular list failed"  );
+    cr_assert(  __links_are_consistent( p_plain ) && List__get_at( p_test, 99 ) == List__get_last( p_plain ),
+        "The spliced run is out of place"  );
+    cr_assert(  0 != __unrolled_nodes( p_list ) && (void*)501 == List__get_at( p_list, 500 ),
+        "Splicing malformed the source"  );
+    List__delete_shallow( &p_plain );
+
+    // Compacting packs every element into full nodes in a single chunk.
+    size_t full_nodes = (1000 + LIST_UNROLLED_SLOTS - 1) / LIST_UNROLLED_SLOTS;
+    cr_assert(  1000 == List__compact( p_list ) && full_nodes == __unrolled_nodes( p_list ), "Compacting should fill the nodes"  );
+    cr_assert(  full_nodes == p_list->pool.capacity && NULL == p_list->pool.chunks->next, "All nodes should share one chunk"  );
+    for ( size_t x = 0; x < 1000; x++ )
+        cr_assert(  (void*)(x + 1) == List__get_at( p_list, x ), "Compacted element '%lu' differs", x  );
+    cr_assert(  full_nodes == List__shrink_to_fit( p_list ), "Shrinking should keep the chunk of live nodes"  );
+
+    // Removing a run merges what's left on either side of it when that fits in half a node.
+    size_t keep = LIST_UNROLLED_SLOTS / 4;
+    p_plain = List__new( 0 );
+    cr_assert(  (int)(1000 - (2 * keep)) == List__splice_range( p_plain, 0, p_list, keep, (999 - keep) ), "Splicing out failed"  );
+    cr_assert(  1 == __unrolled_nodes( p_list ) && (void*)1000 == List__get_last( p_list ), "The ends should share one node"  );
+    cr_assert(  1000 == List__splice_range( p_list, keep, p_plain, 0, (999 - (2 * keep)) ), "Splicing back failed"  );
+    for ( size_t x = 0; x < 1000; x++ )
+        cr_assert(  (void*)(x + 1) == List__get_at( p_list, x ), "Restored element '%lu' differs", x  );
+    List__delete_shallow( &p_plain );
+
+    List__clear_shallow( p_list );
+    cr_assert(  0 == List__length( p_list ) && NULL == p_list->head, "Clear failed"  );
+
+    void* model[400];
+    void* moved[400];
+    size_t len = 0;
+    size_t next_id = 1;
+
+    // Random edits split and merge nodes; the list must keep matching a plain array.
+    srand( 4321 );
+    for ( size_t round = 0; round < 5000; round++ ) {
+        size_t at = (0 == len) ? 0 : (size_t)rand() % len;
+        switch ( rand() % 9 ) {
+            case 0:
+            case 1:
+                if ( len < 400 ) {
+                    at = (size_t)rand() % (len + 1);
+                    memmove( &model[at + 1], &model[at], (len - at) * sizeof(void*) );
+                    model[at] = (void*)(next_id++);
+                    len++;
+                    cr_assert(  (int)at == List__add_at( p_list, model[at], at ), "Add-At failed"  );
+                }
+                break;
+            case 2:
+                if ( len > 0 ) {
+                    cr_assert(  model[at] == List__remove_at( p_list, at ), "Remove-At returned the wrong element"  );
+                    memmove( &model[at], &model[at + 1], (len - at - 1) * sizeof(void*) );
+                    len--;
+                }
+                break;
+            case 3:
+                if ( len > 0 ) {
+                    model[at] = (void*)(next_id++);
+                    List__set_at( p_list, at, model[at] );
+                }
+                break;
+            case 4:
+                if ( len > 0 ) {
+                    cr_assert(  model[0] == List__pop( p_list ), "Pop returned the wrong element"  );
+                    memmove( &model[0], &model[1], (len - 1) * sizeof(void*) );
+                    len--;
+                }
+                break;
+            case 5:
+                if ( len < 400 ) {
+                    memmove( &model[1], &model[0], len * sizeof(void*) );
+                    model[0] = (void*)(next_id++);
+                    len++;
+                    List__push( p_list, model[0] );
+                }
+                break;
+            case 6:
+                if ( len > 0 ) {
+                    cr_assert(  model[len - 1] == List__remove_last( p_list ), "Remove-Last returned the wrong element"  );
+                    len--;
+                } else if ( len < 400 ) {
+                    model[len++] = (void*)(next_id++);
+                    List__add( p_list, model[len - 1] );
+                }
+                break;
+            case 7:
+                // Move a run out to a regular list, then back in somewhere else.
+                if ( len > 0 ) {
+                    size_t run = 1 + ((size_t)rand() % (len - at));
+                    List_t* p_aside = List__new( 0 );
+                    cr_assert(  (int)run == List__splice_range( p_aside, 0, p_list, at, (at + run - 1) ), "Splicing out failed"  );
+                    memcpy( moved, &model[at], run * sizeof(void*) );
+                    memmove( &model[at], &model[at + run], (len - at - run) * sizeof(void*) );
+                    len -= run;
+
+                    at = (size_t)rand() % (len + 1);
+                    cr_assert(  (int)(len + run) == List__splice_range( p_list, at, p_aside, 0, (run - 1) ), "Splicing in failed"  );
+                    memmove( &model[at + run], &model[at], (len - at) * sizeof(void*) );
+                    memcpy( &model[at], moved, run * sizeof(void*) );
+                    len += run;
+                    List__delete_shallow( &p_aside );
+                }
+                break;
+            default:
+                if ( len > 0 ) {
+                    cr_assert(  (int)at == List__index_of( p_list, model[at] ), "Index-Of failed"  );
+                    cr_assert(  model[at] == List__remove_first_occurrence( p_list, model[at] ), "Remove-Occurrence failed"  );
+                    memmove( &model[at], &model[at + 1], (len - at - 1) * sizeof(void*) );
+                    len--;
+                }
+                break;
+        }
+
+        cr_assert(  len == List__length( p_list ), "List length should be '%lu'", len  );
+        cr_assert(  0 == len || 0 != __unrolled_nodes( p_list ), "Malformed node chain"  );
+        if ( len > 0 )
+            cr_assert(  model[at % len] == List__get_at( p_list, (at % len) ), "Element '%lu' differs", (at % len)  );
+    }
+
+    for ( size_t x = 0; x < len; x++ )
+        cr_assert(  model[x] == List__get_at( p_list, x ), "Final element '%lu' differs", x  );
+    List__delete_shallow( &p_list );
+
+    // A deep clear frees the data in every slot.
+    p_list = List__new_with_flags( 50, LIST_UNROLLED );
+    void* p_batch[50];
+    for ( size_t x = 0; x < 50; x++ )
+        *((int*)(p_batch[x] = malloc( sizeof(int) ))) = (int)x;
+    cr_assert(  50 == List__add_many( p_list, p_batch, 50 ), "Add-Many failed"  );
+    cr_assert(  -1 == List__push( p_list, p_batch[0] ), "The list should be full"  );
+
+    long sum = 0;
+    long* p_sum = &sum;
+    List__for_each( p_list, (void**)&p_sum, NULL, __sum_elements, NULL );
+    cr_assert(  1225 == sum, "For-each sum should be 1225; got '%ld'", sum  );
+
+    int* p_array = (int*)List__to_array( p_list, sizeof(int), 0 );
+    cr_assert(  NULL != p_array && 49 == p_array[49] && 0 == p_array[0], "Array conversion failed"  );
+    free( p_array );
+
+    List__delete_deep( &p_list );
+);
+
+TEST_LISTOPS( ptr_find_kernels,
+    ListPtrFind_t kernels[3] = { __List__ptr_find_scalar, __List__ptr_find_kernel(), __List__ptr_find_kernel() };
+#ifdef LIST_SIMD_X86
+    kernels[1] = __List__ptr_find_sse2;
+    if ( __builtin_cpu_supports( "avx2" ) )
+        kernels[2] = __List__ptr_find_avx2;
+#endif
+
+    // Every kernel must agree with a plain loop at every length, needle position, and
+    //   (mis)alignment, including when the needle shows up more than once.
+    void* slots[40];
+    for ( size_t k = 0; k < 3; k++ ) {
+        for ( size_t count = 0; count <= 37; count++ ) {
+            void** pp_data = &slots[count % 3];
+            for ( size_t x = 0; x < count; x++ )
+                pp_data[x] = (void*)(0x1000 + x);
+
+            cr_assert(  count == (*kernels[k])( pp_data, count, (void*)0x1, false ), "Kernel %lu found a missing pointer", k  );
+            cr_assert(  count == (*kernels[k])( pp_data, count, (void*)0x1, true ), "Kernel %lu found a missing pointer", k  );
+
+            for ( size_t at = 0; at < count; at++ ) {
+                void* p_needle = pp_data[at];
+                cr_assert(  at == (*kernels[k])( pp_data, count, p_needle, false ), "Kernel %lu missed slot %lu of %lu", k, at, count  );
+                cr_assert(  at == (*kernels[k])( pp_data, count, p_needle, true ), "Kernel %lu missed slot %lu of %lu", k, at, count  );
+
+                // Only the upper half of the pointer differs, which SSE2 has to notice.
+                cr_assert(  count == (*kernels[k])( pp_data, count, (void*)((uintptr_t)p_needle | ((uintptr_t)1 << 40)), false ),
+                    "Kernel %lu matched half a pointer", k  );
+
+                for ( size_t again = at + 1; again < count; again += 5 ) {
+                    pp_data[again] = p_needle;
+                    cr_assert(  at == (*kernels[k])( pp_data, count, p_needle, false ), "Kernel %lu should find the first copy", k  );
+                    cr_assert(  again == (*kernels[k])( pp_data, count, p_needle, true ), "Kernel %lu should find the last copy", k  );
+                    pp_data[again] = (void*)(0x1000 + again);
+                }
+            }
+        }
+    }
+
+    // Unrolled lists search through the picked kernel.
+    List_t* p_list = List__new_with_flags( 0, LIST_UNROLLED );
+    for ( size_t x = 0; x < 100; x++ )
+        List__add( p_list, List__get_at( p_test, (x % 50) ) );
+    cr_assert(  7 == List__index_of( p_list, List__get_at( p_test, 7 ) ), "Wrong first index"  );
+    cr_assert(  57 == List__last_index_of( p_list, List__get_at( p_test, 7 ) ), "Wrong last index"  );
+    cr_assert(  !List__contains( p_list, List__get_at( p_test, 77 ) ), "Found a missing pointer"  );
+    List__delete_shallow( &p_list );
+);
+
+TEST_LISTOPS_ANY( get_max_and_resize,
+    cr_assert(  100 == List__get_max_size( p_test ), "Improper max size"  );
+
+    for ( size_t x = 0; x < 15; x++ )
+        free(  List__pop( p_test )  );
+    cr_assert(  100 == List__get_max_size( p_test ), "Improper max size after list size change"  );
+
+    cr_assert(  0 == List__resize( p_test, 5 ),
+        "List should not be resizeable below its element count"  );
+
+    cr_assert(  0 != List__resize( p_test, 553 ),
+        "List should be resizeable within element constraints"  );
+    cr_assert(  553 == List__get_max_size( p_test ),
+        "List max size should match the most recent resize"  );
+
+    List_t* p_new = __new_test_list( 0 );
+    cr_assert(  0xFFFFFFFFFFFFFFFF == List__get_max_size( p_new ),
+        "Improper max size for unbounded list; got '%lu'", List__get_max_size( p_new )  );
+    List__delete_deep( &p_new );
+);
+
+
+
+// Callback and for-each testing.
+struct __test_iter_t {
+    int was_callbackd;
+};
+struct __test_res_t {
+    size_t add_result;
+    int stored;
+};
+void __test_action( void* p_data, void* p_input, void** pp_result ) {
+    // Add 4 for each element in the test list.
+    if ( NULL != pp_result && NULL != *pp_result ) {
+        ((struct __test_res_t*)(*pp_result))->add_result =
+            ((struct __test_res_t*)(*pp_result))->add_result + 4;
+    }
+}
+void __test_callback( void* p_input, void** pp_result ) {
+    // Set some static numbers to prove a callback can affect out-of-scope variables.
+    if ( NULL != pp_result && NULL != *pp_result )
+        ((struct __test_res_t*)(*pp_result))->stored = 777;
+
+    ((struct __test_iter_t*)p_input)->was_callbackd = 1;
+}
+void __test_action_print( void* p_data, void* p_input, void** pp_result ) {
+    printf( "Node '%d' ==> |%lu|\n", ((struct __test_iter_t*)p_input)->was_callbackd, *((size_t*)p_data) );
+    (((struct __test_iter_t*)p_input)->was_callbackd)++;
+}
+void __test_callback_print( void* p_input, void** pp_result ) {
+    printf( "PRINTING COMPLETE (callback)\n" );
+}
+
+
+TEST_LISTOPS_ANY( foreach_print,
+    List_t* p_localtest = __create_and_populate( 5 );
+
+    struct __test_res_t* p_res =
+        (struct __test_res_t*)calloc( 1, sizeof(struct __test_res_t) );
+    struct __test_iter_t* p_iter =
+        (struct __test_iter_t*)calloc( 1, sizeof(struct __test_iter_t) );
+
+    printf( "FOR-EACH LOOP TESTING...\n" );
+    List__for_each( p_localtest, (void**)&p_res, (void*)p_iter,
+        &__test_action_print, &__test_callback_print );
+
+    p_iter->was_callbackd = 0;
+    List__reverse( &p_localtest );
+    printf( "[REVERSED] FOR-EACH LOOP TESTING...\n" );
+    List__for_each( p_localtest, (void**)&p_res, (void*)p_iter,
+        &__test_action_print, &__test_callback_print );
+
+    free( p_iter ); free( p_res );
+    List__delete_deep( &p_localtest );
+);
+
+TEST_LISTOPS_ANY( foreach_arithmetic,
+    List_t* p_localtest = __new_test_list( 0 );
+
+    int limit = (rand() % 500) + 500;
+    for ( size_t i = 0; i < limit; i++ ) {
+        size_t* p_d = (size_t*)calloc( 1, sizeof(size_t) );
+        cr_expect( -1 != List__add( p_localtest, p_d ), "List should be add-able" );
+    }
+
+    struct __test_res_t* p_res =
+        (struct __test_res_t*)calloc( 1, sizeof(struct __test_res_t) );
+    struct __test_iter_t* p_iter =
+        (struct __test_iter_t*)calloc( 1, sizeof(struct __test_iter_t) );
+
+    List__for_each( p_localtest, (void**)&p_res, (void*)p_iter,
+        &__test_action, &__test_callback );
+
+    cr_expect( (4*List__length( p_localtest )) == p_res->add_result, "The for-each did not iterate properly" );
+    cr_expect( 1 == p_iter->was_callbackd, "The callback for the struct did not issue properly" );
+    cr_expect( 777 == p_res->stored, "Did not see a proper result struct storage" );
+
+    free( p_res );
+    p_res = (struct __test_res_t*)calloc( 1, sizeof(struct __test_res_t) );
+
+    List__for_each( p_localtest, (void**)&p_res,
+        (void*)p_iter, &__test_action, NULL );
+
+    cr_expect( (4*List__length( p_localtest )) == p_res->add_result,
+        "The NULL callback on the for-each did not iterate properly" );
+
+    free( p_iter ); free( p_res );
+    List__delete_deep( &p_localtest );
+);
+
+
+
+TEST_LISTOPS_ANY( list_to_array,
+    for ( size_t x = 0; x < 5; x++ )
+        free(  List__pop( p_test )  );
+
+    for ( size_t x = 5; x < 30; x += 5 ) {
+        int* p_x = (int*)calloc( 1, sizeof(int) );
+        *p_x = x;
+        cr_assert(  -1 != List__add_at( p_test, p_x, x ), "List should be growable"  );
+    }
+    cr_expect(  100 == List__length( p_test ),
+        "List should be 100 elements but got '%lu'", List__length( p_test )  );
+
+    void* p = List__to_array( p_test, sizeof(int), 0 );
+    cr_assert(  NULL != p, "List conversion to an array failed"  );
+
+    for ( size_t x = 5; x < 30; x += 5 ) {
+        int val = *((int*)(p+(x*sizeof(int))));
+        cr_assert(  (int)x == val, "Array value at index '%lu' should "
+            "be '%d' but got '%d'", x, x, val  );
+    }
+
+    free( p );
+);
+
+TEST_LISTOPS_ANY( list_to_array_chunks,
+    int* p_whole = (int*)List__to_array( p_test, sizeof(int), 0 );
+    cr_assert(  NULL != p_whole, "List conversion to an array failed"  );
+
+    // Stream the list out 7 elements at a time through one small buffer; the extra bytes
+    //   in the buffer are too few for another element and must be left alone.
+    char buffer[(7 * sizeof(int)) + 3];
+    ListCursor_t cursor = List__cursor_begin( p_test );
+    size_t exported = 0, chunks = 0, written;
+    while ( 0 != (written = List__to_array_into( p_test, buffer, sizeof(buffer), sizeof(int), &cursor )) ) {
+        cr_assert(  written == 7 || (exported + written) == 100, "Chunks should be full until the last one"  );
+        cr_assert(  0 == memcmp( buffer, &p_whole[exported], (written * sizeof(int)) ),
+            "Chunk '%lu' should match the whole array", chunks  );
+        exported += written;
+        chunks++;
+    }
+    cr_assert(  100 == exported && 15 == chunks, "The whole list should be exported (%lu in %lu chunks)", exported, chunks  );
+    cr_assert(  List__cursor_at_end( &cursor ) && 100 == cursor.index, "The cursor should end up at the end"  );
+
+    ListCursor_t other = List__cursor_begin( p_t1 );
+    cr_assert(  0 == List__to_array_into( p_test, buffer, sizeof(buffer), sizeof(int), &other ),
+        "Cursors from other lists should be refused"  );
+
+    // NULL elements are zeroed rather than failing the export.
+    int value = 42;
+    List_t* p_holes = __new_test_list( 0 );
+    List__add( p_holes, &value );
+    List__add( p_holes, NULL );
+    List__add( p_holes, &value );
+    cursor = List__cursor_begin( p_holes );
+    int out[3] = { -1, -1, -1 };
+    cr_assert(  3 == List__to_array_into( p_holes, out, sizeof(out), sizeof(int), &cursor ), "All elements should fit"  );
+    cr_assert(  42 == out[0] && 0 == out[1] && 42 == out[2], "NULL elements should be zeroed"  );
+
+    // Pointer arrays hold the data pointers themselves, NULL ones included.
+    void** pp_ptrs = List__to_ptr_array( p_holes );
+    cr_assert(  NULL != pp_ptrs && &value == pp_ptrs[0] && NULL == pp_ptrs[1] && &value == pp_ptrs[2],
+        "Pointer arrays should gather every data pointer"  );
+    free( pp_ptrs );
+
+    pp_ptrs = List__to_ptr_array( p_test );
+    for ( size_t x = 0; x < 100; x++ )
+        cr_assert(  List__get_at( p_test, x ) == pp_ptrs[x], "Pointer '%lu' should match the list", x  );
+    free( pp_ptrs );
+
+    List__clear_shallow( p_holes );
+    cr_assert(  NULL == List__to_ptr_array( p_holes ), "Empty lists have no pointer array"  );
+
+    List__delete_shallow( &p_holes );
+    free( p_whole );
+);
+
+TEST_LISTOPS( array_to_list,
+    void* p_arr = (void*)calloc( 10, sizeof(int) );
+
+    for ( size_t x = 0; x < 10; x++ ) {
+        int* p_x = (int*)(p_arr+(x*sizeof(int)));
+        *p_x = x*10;
+    }
+
+    List_t* p_new = List__from_array( p_arr, sizeof(int), 10, 11 );
+    cr_assert(  10 == List__length( p_new ), "List did not generate properly"  );
+
+    void* p_i = calloc( 1, sizeof(int) );
+    cr_assert(  -1 != List__add( p_new, p_i ), "List did not accept a new element"  );
+
+    p_i = calloc( 1, sizeof(int) );
+    cr_assert(  -1 == List__add( p_new, p_i ), "List accepted a new element when it shouldn't"  );
+
+    for ( size_t x = 0; x < 10; x++ )
+        cr_assert(  (x*10) == *((int*)(List__get_at( p_new, x ))),
+            "List is not organized properly (%lu)", x  );
+
+    free( p_i );
+    free( p_arr );
+    List__delete_deep( &p_new );
+);
+
+TEST_LISTOPS( array_wrap_and_contiguous,
+    int values[1000];
+    for ( size_t x = 0; x < 1000; x++ )  values[x] = x * 3;
+
+    // Wrapped lists point straight into the array and see its changes.
+    List_t* p_wrap = List__wrap_array( values, sizeof(int), 1000, 1000 );
+    cr_assert(  1000 == List__length( p_wrap ), "Wrapped list did not generate properly"  );
+    for ( size_t x = 0; x < 1000; x++ )
+        cr_assert(  &values[x] == List__get_at( p_wrap, x ), "Wrapped list should point into the array (%lu)", x  );
+    values[500] = -1;
+    cr_assert(  -1 == *((int*)List__get_at( p_wrap, 500 )), "Wrapped list should share the array's memory"  );
+    cr_assert(  NULL == List__wrap_array( values, sizeof(int), 1000, 999 ), "Max size must fit the array"  );
+    List__delete_shallow( &p_wrap );
+
+    // Contiguous copies are independent of the array and own one block for all elements.
+    List_t* p_copy = List__from_array_contiguous( values, sizeof(int), 1000, 1001 );
+    cr_assert(  1000 == List__length( p_copy ), "Contiguous list did not generate properly"  );
+    values[0] = 12345;
+    cr_assert(  0 == *((int*)List__get_at( p_copy, 0 )), "Contiguous list should hold its own copy"  );
+    cr_assert(  -1 == *((int*)List__get_at( p_copy, 500 )), "Contiguous list should copy every element"  );
+    cr_assert(  (int*)List__get_at( p_copy, 1 ) == ((int*)List__get_at( p_copy, 0 )) + 1,
+        "Contiguous list elements should be adjacent"  );
+
+    // Later additions are still the caller's own, and deep deletes free both kinds.
+    cr_assert(  -1 != List__add( p_copy, calloc( 1, sizeof(int) ) ), "Contiguous list should accept new elements"  );
+    List__delete_deep( &p_copy );
+    cr_assert(  NULL == p_copy, "Contiguous list should be deleted"  );
+
+    p_copy = List__from_array_contiguous( values, sizeof(int), 1000, 1000 );
+    List__clear_deep( p_copy );
+    cr_assert(  0 == List__length( p_copy ) && NULL == p_copy->p_block, "Deep clears should free the block"  );
+    List__delete_shallow( &p_copy );
+);
+
+
+
+///////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////
+// SPEED TESTS.
+
+TestSuite( speed, .disabled = true );
+
+
+
+static inline List_t* __test__List__clone_forloop( List_t* p_list ) {
+    size_t len = List__length( p_list );
+    if ( NULL == p_list || 0 == len )  return NULL;
+
+    List_t* p_new = List__new( p_list->max_size );
+
+    p_new->head = LIST_NODE_INITIALIZER( p_new );
+    p_new->head->data = p_list->head->data;
+
+    ListNode_t* p_scroll = p_new->head;
+
+    // Construct blank list nodes to start.
+    for ( size_t x = 1; x < len; x++ ) {
+        ListNode_t* p_new_node = LIST_NODE_INITIALIZER( p_new );
+
+        p_scroll->next = p_new_node;
+        p_scroll = p_new_node;
+    }
+
+    p_new->tail = p_scroll;
+    p_new->count = len;
+
+    // Loop again and fill out the data.
+    p_scroll = p_new->head->next;
+    ListNode_t* p_src_scroll = p_list->head->next;
+
+    for ( size_t x = 1; x < len; x++ ) {
+        p_scroll->data = p_src_scroll->data;
+
+        p_scroll = p_scroll->next;
+        p_src_scroll = p_src_scroll->next;
+    }
+
+    // Return the new List_t shallow clone.
+    return p_new;
+}
+static inline List_t* __test__List__clone_addcall( List_t* p_list ) {
+    size_t len = List__length( p_list );
+    if ( NULL == p_list || 0 == len )  return NULL;
+
+    List_t* p_new = List__new( p_list->max_size );
+    ListNode_t* p_scroll = p_list->head;
+
+    while ( NULL != p_scroll ) {
+        if (  -1 == List__add( p_new, p_scroll->data )  ) {
+            // If something goes wrong, revert the list changes and destroy the clone.
+            List__delete_shallow( &p_new );
+            return NULL;
+        }
+
+        p_scroll = p_scroll->next;
+    }
+
+    return p_new;
+}
 
 Test( speed, clone__for_vs_add ) {
     printf( "RUNNING TEST: clone__for_vs_add\n" );
@@ -709,8 +2611,8 @@ Test( speed, clone__for_vs_add ) {
     double time_spent2 = (double)(add_end - add_start) / CLOCKS_PER_SEC;
     printf( "\t\tList t2 cloned by ADD in '%f' seconds.\n", time_spent2 );
 
-    free( p_t1a );
-    free( p_t2a );
+    List__delete_shallow( &p_t1a );
+    List__delete_shallow( &p_t2a );
     List__delete_deep( &p_t1 );
     List__delete_deep( &p_t2 );
 }
@@ -742,11 +2644,13 @@ Test( speed, clear__pop_vs_iter ) {
     size_t x2 = 0;
     while ( NULL != p_node2 ) {
         ListNode_t* p_shadow = p_node2->next;
-        free( p_node2 );
+        LIST_NODE_RELEASE( p_t2, p_node2 );
         p_node2 = p_shadow;
         x2++;
     }
     p_t2->head = NULL;
+    p_t2->tail = NULL;
+    p_t2->count = 0;
     clock_t iter_end = clock();
     cr_expect(  0 == List__length( p_t2 ), "List 2 should be empty"  );
     double time_spent2 = (double)(iter_end - iter_begin) / CLOCKS_PER_SEC;
@@ -755,3 +2659,630 @@ Test( speed, clear__pop_vs_iter ) {
     List__delete_deep( &p_t1 );
     List__delete_deep( &p_t2 );
 }
+
+
+
+static inline List_t* __test__List__sort_roundtrip( List_t* p_list ) {
+    // The way to sort before List__sort: copy out, qsort the array, and copy back in.
+    size_t len = List__length( p_list );
+    int* p_array = (int*)List__to_array( p_list, sizeof(int), 0 );
+    qsort( p_array, len, sizeof(int), __compare_ints );
+
+    List_t* p_sorted = List__from_array( p_array, sizeof(int), len, len );
+    free( p_array );
+
+    return p_sorted;
+}
+
+Test( speed, sort__merge_vs_array_roundtrip ) {
+    printf( "RUNNING TEST: sort__merge_vs_array_roundtrip\n" );
+
+    for ( size_t count = 1000; count <= 10000000; count *= 10 ) {
+        List_t* p_t1 = __create_and_populate( count );
+        List_t* p_t2 = __create_and_populate( count );
+
+        clock_t sort_start = clock();
+        List__sort( p_t1, __compare_ints );
+        clock_t sort_end = clock();
+        double time_spent1 = (double)(sort_end - sort_start) / CLOCKS_PER_SEC;
+
+        clock_t trip_start = clock();
+        List_t* p_t2a = __test__List__sort_roundtrip( p_t2 );
+        clock_t trip_end = clock();
+        double time_spent2 = (double)(trip_end - trip_start) / CLOCKS_PER_SEC;
+
+        cr_expect(  count == List__length( p_t2a ), "Round-trip should keep every element"  );
+        printf( "\t\tSorted %lu elements: MERGE |%f|, ROUNDTRIP |%f|\n", count, time_spent1, time_spent2 );
+
+        List__delete_deep( &p_t1 );
+        List__delete_deep( &p_t2 );
+        List__delete_deep( &p_t2a );
+    }
+}
+
+
+
+Test( speed, sort__sequential_vs_parallel ) {
+    printf( "RUNNING TEST: sort__sequential_vs_parallel\n" );
+    size_t count = 10000000;
+
+    List_t* p_src = __create_and_populate( count );
+
+    for ( size_t threads = 1; threads <= 64; threads *= 2 ) {
+        List_t* p_t1 = List__clone( p_src );
+
+        // Wall-clock time, since clock() adds up the CPU time of every thread.
+        struct timespec start, end;
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        List__sort_parallel( p_t1, __compare_ints, threads );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+
+        double time_spent = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+        printf( "\t\tSorted %lu elements on %lu threads: |%f|\n", count, threads, time_spent );
+
+        List__delete_shallow( &p_t1 );
+    }
+
+    List__delete_deep( &p_src );
+}
+
+
+
+static void __hash_action( void* p_data, void* p_input, void** pp_result ) {
+    // Stand-in for a CPU-heavy action: hash the element over and over.
+    unsigned long long hash = 0xCBF29CE484222325ULL;
+    for ( size_t x = 0; x < 2000; x++ )
+        hash = (hash ^ (unsigned long long)*((int*)p_data) ^ x) * 0x100000001B3ULL;
+
+    *pp_result = (void*)((uintptr_t)*pp_result ^ (uintptr_t)hash);
+}
+
+static void __hash_combine( void* p_partial, void* p_input, void** pp_result ) {
+    *pp_result = (void*)((uintptr_t)*pp_result ^ (uintptr_t)p_partial);
+}
+
+Test( speed, for_each__sequential_vs_parallel ) {
+    printf( "RUNNING TEST: for_each__sequential_vs_parallel\n" );
+    size_t count = 200000;
+
+    List_t* p_t1 = __create_and_populate( count );
+
+    for ( size_t workers = 0; workers <= 8; workers = (0 == workers) ? 1 : (workers * 2) ) {
+        ListThreadPool_t* p_pool = List__thread_pool_new( workers );
+        void* p_result = NULL;
+
+        struct timespec start, end;
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        List__for_each_parallel( p_t1, p_pool, &p_result, NULL, __hash_action, __hash_combine, NULL );
+        clock_gettime( CLOCK_MONOTONIC, &end );
+
+        double time_spent = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+        printf( "\t\tHashed %lu elements with %lu workers: |%f| (%p)\n", count, workers, time_spent, p_result );
+
+        List__thread_pool_delete( &p_pool );
+    }
+
+    List__delete_deep( &p_t1 );
+}
+
+
+
+typedef struct {
+    List_t* p_list;
+    pthread_mutex_t* p_lock;   // NULL for the lock-free stack.
+    size_t pairs;
+} __stack_bench_t;
+
+static void* __stack_bench_worker( void* p_arg ) {
+    __stack_bench_t* p_bench = (__stack_bench_t*)p_arg;
+    int value = 0;
+
+    for ( size_t x = 0; x < p_bench->pairs; x++ ) {
+        if ( NULL == p_bench->p_lock ) {
+            List__push( p_bench->p_list, &value );
+            List__pop( p_bench->p_list );
+        } else {
+            pthread_mutex_lock( p_bench->p_lock );
+            List__push( p_bench->p_list, &value );
+            pthread_mutex_unlock( p_bench->p_lock );
+            pthread_mutex_lock( p_bench->p_lock );
+            List__pop( p_bench->p_list );
+            pthread_mutex_unlock( p_bench->p_lock );
+        }
+    }
+
+    return NULL;
+}
+
+Test( speed, stack__lock_free_vs_mutex ) {
+    printf( "RUNNING TEST: stack__lock_free_vs_mutex\n" );
+    size_t pairs = 2000000;
+
+    for ( size_t threads = 1; threads <= 8; threads *= 2 ) {
+        for ( int locked = 0; locked <= 1; locked++ ) {
+            pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+            List_t* p_list = List__new_with_flags( 0, locked ? LIST_FLAGS_NONE : LIST_CONCURRENT_STACK );
+
+            pthread_t workers[8];
+            __stack_bench_t bench = { p_list, locked ? &lock : NULL, pairs / threads };
+
+            struct timespec start, end;
+            clock_gettime( CLOCK_MONOTONIC, &start );
+            for ( size_t t = 0; t < threads; t++ )
+                pthread_create( &workers[t], NULL, __stack_bench_worker, &bench );
+            for ( size_t t = 0; t < threads; t++ )
+                pthread_join( workers[t], NULL );
+            clock_gettime( CLOCK_MONOTONIC, &end );
+
+            double time_spent = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+            printf( "\t\t%lu push/pop pairs on %lu threads (%s): |%f|\n",
+                pairs, threads, locked ? "mutex" : "lock-free", time_spent );
+
+            List__delete_shallow( &p_list );
+        }
+    }
+}
+
+
+
+typedef struct {
+    List_t* p_list;
+    pthread_mutex_t* p_lock;   // NULL for the lock-free queue.
+    size_t pairs;
+} __queue_bench_t;
+
+static void* __queue_bench_worker( void* p_arg ) {
+    __queue_bench_t* p_bench = (__queue_bench_t*)p_arg;
+    int value = 0;
+
+    for ( size_t x = 0; x < p_bench->pairs; x++ ) {
+        if ( NULL == p_bench->p_lock ) {
+            List__add( p_bench->p_list, &value );
+            List__pop( p_bench->p_list );
+        } else {
+            pthread_mutex_lock( p_bench->p_lock );
+            List__add( p_bench->p_list, &value );
+            pthread_mutex_unlock( p_bench->p_lock );
+            pthread_mutex_lock( p_bench->p_lock );
+            List__pop( p_bench->p_list );
+            pthread_mutex_unlock( p_bench->p_lock );
+        }
+    }
+
+    return NULL;
+}
+
+Test( speed, queue__lock_free_vs_mutex ) {
+    printf( "RUNNING TEST: queue__lock_free_vs_mutex\n" );
+    size_t pairs = 2000000;
+
+    for ( size_t threads = 1; threads <= 64; threads *= 2 ) {
+        for ( int locked = 0; locked <= 1; locked++ ) {
+            pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+            List_t* p_list = List__new_with_flags( 0, locked ? LIST_FLAGS_NONE : LIST_CONCURRENT_QUEUE );
+
+            pthread_t workers[64];
+            __queue_bench_t bench = { p_list, locked ? &lock : NULL, pairs / threads };
+
+            struct timespec start, end;
+            clock_gettime( CLOCK_MONOTONIC, &start );
+            for ( size_t t = 0; t < threads; t++ )
+                pthread_create( &workers[t], NULL, __queue_bench_worker, &bench );
+            for ( size_t t = 0; t < threads; t++ )
+                pthread_join( workers[t], NULL );
+            clock_gettime( CLOCK_MONOTONIC, &end );
+
+            double time_spent = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+            printf( "\t\t%lu add/pop pairs on %lu threads (%s): |%f| (%.1f Mops/s)\n",
+                pairs, threads, locked ? "mutex" : "lock-free", time_spent, (2.0 * pairs) / time_spent / 1e6 );
+
+            List__delete_shallow( &p_list );
+        }
+    }
+}
+
+
+
+typedef struct {
+    List_t* p_list;
+    size_t items;
+    size_t batch;
+} __ring_bench_t;
+
+static void* __ring_bench_producer( void* p_arg ) {
+    __ring_bench_t* p_bench = (__ring_bench_t*)p_arg;
+    void* pp_batch[256];
+    for ( size_t x = 0; x < p_bench->batch; x++ )  pp_batch[x] = p_bench;
+
+    for ( size_t sent = 0; sent < p_bench->items; ) {
+        int result = (1 == p_bench->batch)
+            ? List__add( p_bench->p_list, pp_batch[0] )
+            : List__add_many( p_bench->p_list, pp_batch, p_bench->batch );
+
+        if ( -1 == result )  sched_yield();
+        else  sent += p_bench->batch;
+    }
+
+    return NULL;
+}
+
+Test( speed, spsc__ring_vs_concurrent_queue ) {
+    printf( "RUNNING TEST: spsc__ring_vs_concurrent_queue\n" );
+    size_t items = 20000000;
+
+    for ( size_t batch = 0; batch <= 256; batch = (0 == batch) ? 1 : (batch * 16) ) {
+        // Batch '0' stands for the lock-free (node-based) queue, one element at a time.
+        List_t* p_list = (0 == batch)
+            ? List__new_with_flags( 4096, LIST_CONCURRENT_QUEUE )
+            : List__new_with_flags( 4096, LIST_SPSC_RING );
+        __ring_bench_t bench = { p_list, items, (0 == batch) ? 1 : batch };
+
+        struct timespec start, end;
+        clock_gettime( CLOCK_MONOTONIC, &start );
+
+        pthread_t producer;
+        pthread_create( &producer, NULL, __ring_bench_producer, &bench );
+
+        void* pp_out[256];
+        for ( size_t received = 0; received < items; ) {
+            size_t popped = (0 == batch)
+                ? (NULL != (pp_out[0] = List__pop( p_list )))
+                : List__pop_many( p_list, pp_out, bench.batch );
+            if ( 0 == popped )  sched_yield();
+            received += popped;
+        }
+        pthread_join( producer, NULL );
+
+        clock_gettime( CLOCK_MONOTONIC, &end );
+
+        double time_spent = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+        printf( "\t\tStreamed %lu elements (%s, batches of %lu): |%f| (%.1f Mops/s)\n",
+            items, (0 == batch) ? "queue" : "ring", bench.batch, time_spent, items / time_spent / 1e6 );
+
+        List__delete_shallow( &p_list );
+    }
+}
+
+
+
+Test( speed, add__loop_vs_many ) {
+    printf( "RUNNING TEST: add__loop_vs_many\n" );
+    size_t count = 5000000;
+    void** pp_data = calloc( count, sizeof(void*) );
+    for ( size_t x = 0; x < count; x++ )  pp_data[x] = &pp_data[x];
+
+    List_t* p_t1 = List__new( 0 );
+    clock_t begin = clock();
+    for ( size_t x = 0; x < count; x++ )
+        List__add( p_t1, pp_data[x] );
+    printf( "\t\tAdded %lu elements one by one: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    List_t* p_t2 = List__new( 0 );
+    begin = clock();
+    List__add_many( p_t2, pp_data, count );
+    printf( "\t\tAdded %lu elements in one batch: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    List_t* p_t3 = List__new( 0 );
+    begin = clock();
+    List__extend( p_t3, p_t2 );
+    printf( "\t\tExtended by %lu elements: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    List__delete_shallow( &p_t1 );
+    List__delete_shallow( &p_t2 );
+    List__delete_shallow( &p_t3 );
+    free( pp_data );
+}
+
+
+
+Test( speed, from_array__copy_vs_contiguous_vs_wrap ) {
+    printf( "RUNNING TEST: from_array__copy_vs_contiguous_vs_wrap\n" );
+    size_t count = 5000000;
+    int* p_values = calloc( count, sizeof(int) );
+
+    clock_t begin = clock();
+    List_t* p_t1 = List__from_array( p_values, sizeof(int), count, count );
+    printf( "\t\tCopied %lu elements one by one: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    begin = clock();
+    List_t* p_t2 = List__from_array_contiguous( p_values, sizeof(int), count, count );
+    printf( "\t\tCopied %lu elements into one block: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    begin = clock();
+    List_t* p_t3 = List__wrap_array( p_values, sizeof(int), count, count );
+    printf( "\t\tWrapped %lu elements: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    begin = clock();
+    List__delete_deep( &p_t1 );
+    List__delete_deep( &p_t2 );
+    List__delete_shallow( &p_t3 );
+    printf( "\t\tDeleted all three: |%f|\n", (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    free( p_values );
+}
+
+
+
+Test( speed, to_array__whole_vs_chunks_vs_ptrs ) {
+    printf( "RUNNING TEST: to_array__whole_vs_chunks_vs_ptrs\n" );
+    size_t count = 5000000;
+
+    List_t* p_t1 = __create_and_populate( count );
+
+    clock_t begin = clock();
+    void* p_whole = List__to_array( p_t1, sizeof(int), 0 );
+    printf( "\t\tExported %lu elements at once: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    int buffer[4096];
+    size_t exported = 0;
+    begin = clock();
+    ListCursor_t cursor = List__cursor_begin( p_t1 );
+    for ( size_t written; 0 != (written = List__to_array_into( p_t1, buffer, sizeof(buffer), sizeof(int), &cursor )); )
+        exported += written;
+    printf( "\t\tExported %lu elements in 16 KiB chunks: |%f|\n", exported, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    begin = clock();
+    void** pp_ptrs = List__to_ptr_array( p_t1 );
+    printf( "\t\tGathered %lu data pointers: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    free( pp_ptrs );
+    free( p_whole );
+    List__delete_deep( &p_t1 );
+}
+
+
+
+Test( speed, copy__per_element_vs_contiguous ) {
+    printf( "RUNNING TEST: copy__per_element_vs_contiguous\n" );
+    size_t count = 5000000;
+
+    List_t* p_src = __create_and_populate( count );
+
+    clock_t begin = clock();
+    List_t* p_t1 = List__copy( p_src, sizeof(int) );
+    printf( "\t\tCopied %lu elements one by one: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    begin = clock();
+    List__delete_deep( &p_t1 );
+    printf( "\t\tDeleted the per-element copy: |%f|\n", (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    begin = clock();
+    List_t* p_t2 = List__copy_contiguous( p_src, sizeof(int) );
+    printf( "\t\tCopied %lu elements contiguously: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    begin = clock();
+    List__delete_deep( &p_t2 );
+    printf( "\t\tDeleted the contiguous copy: |%f|\n", (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    List__delete_deep( &p_src );
+}
+
+
+
+Test( speed, traverse__fragmented_vs_compacted ) {
+    printf( "RUNNING TEST: traverse__fragmented_vs_compacted\n" );
+    size_t count = 5000000;
+
+    // Sorting random values relinks the nodes into an order unrelated to their addresses.
+    List_t* p_t1 = __create_and_populate( count );
+    List__sort( p_t1, __compare_ints );
+
+    long sum = 0;
+    void* p_sum = &sum;
+    clock_t begin = clock();
+    for ( int round = 0; round < 5; round++ )
+        List__for_each( p_t1, &p_sum, NULL, __sum_elements, NULL );
+    printf( "\t\tWalked %lu fragmented nodes 5 times: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    begin = clock();
+    List__compact( p_t1 );
+    printf( "\t\tCompacted %lu nodes: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    begin = clock();
+    for ( int round = 0; round < 5; round++ )
+        List__for_each( p_t1, &p_sum, NULL, __sum_elements, NULL );
+    printf( "\t\tWalked %lu compacted nodes 5 times: |%f| (%ld)\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC, sum );
+
+    List__delete_deep( &p_t1 );
+}
+
+
+
+Test( speed, merge__copy_vs_splice ) {
+    printf( "RUNNING TEST: merge__copy_vs_splice\n" );
+    size_t count = 5000000;
+
+    List_t* p_dest = __create_and_populate( count );
+    List_t* p_src = __create_and_populate( count );
+    List__resize( p_dest, (3 * count) );
+
+    // What merging used to do: copy every node over, then drop the source's.
+    clock_t begin = clock();
+    List__extend_at( p_dest, p_src, (count / 2) );
+    List__clear_shallow( p_src );
+    printf( "\t\tMerged %lu elements by copying: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    List_t* p_src2 = __create_and_populate( count );
+    begin = clock();
+    List__merge( p_dest, p_src2 );
+    printf( "\t\tMerged %lu elements by moving nodes: |%f|\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    List__delete_deep( &p_dest );
+    List__delete_shallow( &p_src );
+    List__delete_shallow( &p_src2 );
+}
+
+
+
+Test( speed, clone__copy_vs_shared ) {
+    printf( "RUNNING TEST: clone__copy_vs_shared\n" );
+    size_t count = 100000;
+    size_t rounds = 1000;
+
+    List_t* p_plain = List__new( 0 );
+    List_t* p_cow = List__new_with_flags( 0, LIST_COPY_ON_WRITE );
+    for ( size_t x = 0; x < count; x++ ) {
+        List__add( p_plain, (void*)(x + 1) );
+        List__add( p_cow, (void*)(x + 1) );
+    }
+
+    // Each round takes a snapshot, reads its tail, and throws it away.
+    clock_t begin = clock();
+    for ( size_t x = 0; x < rounds; x++ ) {
+        List_t* p_snapshot = List__clone( p_plain );
+        List__get_last( p_snapshot );
+        List__delete_shallow( &p_snapshot );
+    }
+    printf( "\t\tCloned %lu elements %lu times by copying: |%f|\n", count, rounds, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    begin = clock();
+    for ( size_t x = 0; x < rounds; x++ ) {
+        List_t* p_snapshot = List__clone( p_cow );
+        List__get_last( p_snapshot );
+        List__delete_shallow( &p_snapshot );
+    }
+    printf( "\t\tCloned %lu elements %lu times by sharing: |%f|\n", count, rounds, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    // A clone which does get changed pays for one copy of the chain.
+    begin = clock();
+    for ( size_t x = 0; x < rounds; x++ ) {
+        List_t* p_snapshot = List__clone( p_cow );
+        List__add( p_snapshot, NULL );
+        List__delete_shallow( &p_snapshot );
+    }
+    printf( "\t\tCloned and changed %lu elements %lu times by sharing: |%f|\n", count, rounds, (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+    List__delete_shallow( &p_plain );
+    List__delete_shallow( &p_cow );
+}
+
+
+
+Test( speed, slice__copy_vs_view ) {
+    printf( "RUNNING TEST: slice__copy_vs_view\n" );
+    size_t count = 1000000;
+    size_t page = 100000;
+
+    List_t* p_t1 = __create_and_populate( count );
+
+    // Page through the whole list, summing the first element of every page.
+    long sum = 0;
+    clock_t begin = clock();
+    for ( size_t x = 0; x < count; x += page ) {
+        List_t* p_slice = List__slice( p_t1, x, (x + page - 1) );
+        sum += *((int*)List__get_first( p_slice ));
+        List__delete_shallow( &p_slice );
+    }
+    printf( "\t\tPaged %lu elements by slicing: |%f| (%ld)\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC, sum );
+
+    sum = 0;
+    begin = clock();
+    for ( size_t x = 0; x < count; x += page ) {
+        ListView_t view = List__slice_view( p_t1, x, (x + page - 1) );
+        sum += *((int*)List__view_get_at( &view, 0 ));
+    }
+    printf( "\t\tPaged %lu elements through views: |%f| (%ld)\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC, sum );
+
+    List__delete_deep( &p_t1 );
+}
+
+
+
+Test( speed, get_at__head_vs_finger ) {
+    printf( "RUNNING TEST: get_at__head_vs_finger\n" );
+    size_t count = 50000;
+
+    List_t* p_t1 = __create_and_populate( count );
+
+    // Dropping the finger before every lookup walks from the HEAD each time.
+    long sum = 0;
+    clock_t begin = clock();
+    for ( size_t x = 0; x < count; x++ ) {
+        p_t1->p_finger = NULL;
+        sum += *((int*)List__get_at( p_t1, x ));
+    }
+    printf( "\t\tRead %lu elements by index from the HEAD: |%f| (%ld)\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC, sum );
+
+    sum = 0;
+    begin = clock();
+    for ( size_t x = 0; x < count; x++ )
+        sum += *((int*)List__get_at( p_t1, x ));
+    printf( "\t\tRead %lu elements by index from the finger: |%f| (%ld)\n", count, (double)(clock() - begin) / CLOCKS_PER_SEC, sum );
+
+    List__delete_deep( &p_t1 );
+}
+
+
+
+Test( speed, traverse__nodes_vs_unrolled ) {
+    printf( "RUNNING TEST: traverse__nodes_vs_unrolled\n" );
+    size_t count = 5000000;
+    void** pp_data = calloc( count, sizeof(void*) );
+    for ( size_t x = 0; x < count; x++ )  pp_data[x] = &pp_data[x];
+
+    unsigned int flag_sets[] = { LIST_FLAGS_NONE, LIST_UNROLLED };
+    const char* names[] = { "one per node", "unrolled" };
+
+    for ( size_t f = 0; f < 2; f++ ) {
+        List_t* p_list = List__new_with_flags( 0, flag_sets[f] );
+
+        clock_t begin = clock();
+        List__add_many( p_list, pp_data, count );
+        printf( "\t\tAdded %lu elements (%s): |%f| (%lu node bytes)\n", count, names[f],
+            (double)(clock() - begin) / CLOCKS_PER_SEC, (p_list->pool.capacity * p_list->pool.node_size) );
+
+        // Searching for a missing pointer walks the whole list.
+        begin = clock();
+        for ( size_t x = 0; x < 10; x++ )
+            cr_assert(  !List__contains( p_list, &count ), "The pointer isn't in the list"  );
+        printf( "\t\tSearched %lu elements 10 times (%s): |%f|\n", count, names[f], (double)(clock() - begin) / CLOCKS_PER_SEC );
+
+        // Draining from the TAIL needs each node's predecessor.
+        List_t* p_drain = List__new_with_flags( 0, (flag_sets[f] | ((LIST_UNROLLED == flag_sets[f]) ? 0 : LIST_DOUBLY_LINKED)) );
+        List__add_many( p_drain, pp_data, (count / 10) );
+        begin = clock();
+        while ( NULL != List__remove_last( p_drain ) );
+        printf( "\t\tDrained %lu elements from the TAIL (%s): |%f|\n", (count / 10), names[f], (double)(clock() - begin) / CLOCKS_PER_SEC );
+        List__delete_shallow( &p_drain );
+
+        List__delete_shallow( &p_list );
+    }
+
+    free( pp_data );
+}
+
+
+
+
+Test( speed, search__scalar_vs_simd ) {
+    printf( "RUNNING TEST: search__scalar_vs_simd\n" );
+    size_t count = 1000000;
+    void** pp_data = calloc( count, sizeof(void*) );
+    for ( size_t x = 0; x < count; x++ )  pp_data[x] = &pp_data[x];
+
+    ListPtrFind_t kernels[] = { __List__ptr_find_scalar, __List__ptr_find_kernel() };
+    const char* names[] = { "scalar", "picked kernel" };
+
+    // Searching for a missing pointer reads every slot.
+    for ( size_t k = 0; k < 2; k++ ) {
+        size_t misses = 0;
+        clock_t begin = clock();
+        for ( size_t x = 0; x < 100; x++ )
+            misses += (count == (*kernels[k])( pp_data, count, &count, (x & 1) ));
+        printf( "\t\tSearched %lu pointers 100 times (%s): |%f| (%lu)\n", count, names[k], (double)(clock() - begin) / CLOCKS_PER_SEC, misses );
+    }
+
+    // Unrolled lists only search 13 slots per node, which cuts the gain.
+    List_t* p_list = List__new_with_flags( 0, LIST_UNROLLED );
+    List__add_many( p_list, pp_data, count );
+    for ( size_t k = 0; k < 2; k++ ) {
+        atomic_store( &__list_ptr_find, kernels[k] );
+        clock_t begin = clock();
+        for ( size_t x = 0; x < 100; x++ )
+            cr_assert(  -1 == List__index_of( p_list, &count ), "The pointer isn't in the list"  );
+        printf( "\t\tSearched an unrolled list of %lu 100 times (%s): |%f|\n", count, names[k], (double)(clock() - begin) / CLOCKS_PER_SEC );
+    }
+
+    List__delete_shallow( &p_list );
+    free( pp_data );
+}